@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares batched N x N matrix products in the array of structs layout of
+// examples/tut_batched-matrix-multiply.cpp, one matrix per loop iteration,
+// with RAJA::expt::batched_matrix_multiply on the interleaved layout of
+// RAJA::expt::BatchedMatrixView, one register of matrices per iteration.
+//
+// Each benchmark is parameterized by the number of matrices.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename EXEC_POL, RAJA::Index_type N>
+static void benchmark_aos(benchmark::State& state)
+{
+  const RAJA::Index_type batch = state.range(0);
+  std::vector<double> a(batch * N * N, 1.0);
+  std::vector<double> b(batch * N * N, 0.5);
+  std::vector<double> c(batch * N * N, 0.0);
+
+  // Aview(e, r, c) is A[c + N*(r + N*e)]
+  RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>
+      Aview(a.data(), batch, N, N);
+  RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>
+      Bview(b.data(), batch, N, N);
+  RAJA::View<double, RAJA::Layout<3, RAJA::Index_type, 2>>
+      Cview(c.data(), batch, N, N);
+
+  for (auto _ : state) {
+    RAJA::forall<EXEC_POL>(
+        RAJA::RangeSegment(0, batch), [=](RAJA::Index_type e) {
+          for (RAJA::Index_type r = 0; r < N; ++r) {
+            for (RAJA::Index_type col = 0; col < N; ++col) {
+              double dot = 0.0;
+              for (RAJA::Index_type k = 0; k < N; ++k) {
+                dot += Aview(e, r, k) * Bview(e, k, col);
+              }
+              Cview(e, r, col) = dot;
+            }
+          }
+        });
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template <typename EXEC_POL, camp::idx_t N>
+static void benchmark_batched(benchmark::State& state)
+{
+  using view_t = RAJA::expt::BatchedMatrixView<double, N, N>;
+
+  const camp::idx_t batch = state.range(0);
+  std::vector<double> a(view_t::alloc_size(batch), 1.0);
+  std::vector<double> b(view_t::alloc_size(batch), 0.5);
+  std::vector<double> c(view_t::alloc_size(batch), 0.0);
+
+  view_t A(a.data(), batch);
+  view_t B(b.data(), batch);
+  view_t C(c.data(), batch);
+
+  for (auto _ : state) {
+    RAJA::expt::batched_matrix_multiply<EXEC_POL>(C, A, B);
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK_TEMPLATE(benchmark_aos, RAJA::loop_exec, 3)
+    ->Name("multiply3x3/aos/loop")->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_batched, RAJA::seq_exec, 3)
+    ->Name("multiply3x3/batched/seq")->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_batched, RAJA::loop_exec, 3)
+    ->Name("multiply3x3/batched/loop")->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_batched, RAJA::simd_exec, 3)
+    ->Name("multiply3x3/batched/simd")->Arg(1 << 10)->Arg(1 << 20);
+
+BENCHMARK_TEMPLATE(benchmark_aos, RAJA::loop_exec, 8)
+    ->Name("multiply8x8/aos/loop")->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(benchmark_batched, RAJA::loop_exec, 8)
+    ->Name("multiply8x8/batched/loop")->Arg(1 << 10)->Arg(1 << 16);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_aos, RAJA::omp_parallel_for_exec, 3)
+    ->Name("multiply3x3/aos/omp")->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_batched, RAJA::omp_parallel_for_exec, 3)
+    ->Name("multiply3x3/batched/omp")->Arg(1 << 20);
+#endif
+
+BENCHMARK_MAIN();
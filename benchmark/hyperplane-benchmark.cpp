@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares 3D wavefront sweeps, in which every zone depends on its lower
+// neighbors, run with statement::Hyperplane over points and with
+// statement::TiledHyperplane over tiles.
+//
+// Each benchmark is parameterized by the number of zones per dimension.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using view_t = RAJA::View<double, RAJA::Layout<3, int, 2>>;
+
+template <typename POLICY>
+static void benchmark_sweep(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> psi(n * n * n, 0.0);
+  view_t Psi(psi.data(), n, n, n);
+
+  RAJA::TypedRangeSegment<int> zones(0, n);
+
+  for (auto _ : state) {
+    RAJA::kernel<POLICY>(
+        RAJA::make_tuple(zones, zones, zones),
+        [=](int i, int j, int k) {
+          double upwind = 1.0;
+          if (i > 0) upwind += Psi(i - 1, j, k);
+          if (j > 0) upwind += Psi(i, j - 1, k);
+          if (k > 0) upwind += Psi(i, j, k - 1);
+          Psi(i, j, k) = 0.25 * upwind;
+        });
+    benchmark::DoNotOptimize(psi.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+using HyperplaneSeqPolicy = RAJA::KernelPolicy<
+    RAJA::statement::Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1, 2>,
+                                RAJA::loop_exec,
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+using TiledHyperplaneSeqPolicy = RAJA::KernelPolicy<
+    RAJA::statement::TiledHyperplane<RAJA::ArgList<0, 1, 2>,
+                                     RAJA::tile_fixed_sizes<8, 8, 64>,
+                                     RAJA::seq_exec,
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+BENCHMARK_TEMPLATE(benchmark_sweep, HyperplaneSeqPolicy)
+    ->Name("sweep/hyperplane/seq")->Arg(64)->Arg(192);
+BENCHMARK_TEMPLATE(benchmark_sweep, TiledHyperplaneSeqPolicy)
+    ->Name("sweep/tiled/seq")->Arg(64)->Arg(192);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using HyperplaneOmpPolicy = RAJA::KernelPolicy<
+    RAJA::statement::Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1, 2>,
+                                RAJA::omp_parallel_collapse_exec,
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+using TiledHyperplaneOmpPolicy = RAJA::KernelPolicy<
+    RAJA::statement::TiledHyperplane<RAJA::ArgList<0, 1, 2>,
+                                     RAJA::tile_fixed_sizes<8, 8, 64>,
+                                     RAJA::omp_parallel_for_exec,
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+using TiledHyperplaneDataflowPolicy = RAJA::KernelPolicy<
+    RAJA::statement::TiledHyperplane<RAJA::ArgList<0, 1, 2>,
+                                     RAJA::tile_fixed_sizes<8, 8, 64>,
+                                     RAJA::omp_hyperplane_dataflow_exec,
+      RAJA::statement::Lambda<0>
+    >
+  >;
+
+BENCHMARK_TEMPLATE(benchmark_sweep, HyperplaneOmpPolicy)
+    ->Name("sweep/hyperplane/omp")->Arg(64)->Arg(192);
+BENCHMARK_TEMPLATE(benchmark_sweep, TiledHyperplaneOmpPolicy)
+    ->Name("sweep/tiled/omp")->Arg(64)->Arg(192);
+BENCHMARK_TEMPLATE(benchmark_sweep, TiledHyperplaneDataflowPolicy)
+    ->Name("sweep/tiled/omp_dataflow")->Arg(64)->Arg(192);
+#endif
+
+BENCHMARK_MAIN();
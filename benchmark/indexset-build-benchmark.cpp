@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares building index sets from masks of a 3D mesh with the serial
+// buildIndexSetAligned and the parallel buildIndexSetStrided. The masks
+// model adaptive mesh refinement tags: the zones inside a sphere (long
+// rows), the zones of a thin spherical shell (short rows), and the red
+// zones of a red-black ordering (stride 2 rows).
+//
+// Each benchmark is parameterized by the number of zones per dimension
+// and the mask.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+enum mask_kind { mask_sphere, mask_shell, mask_red_black };
+
+static std::vector<RAJA::Index_type> make_mask_indices(int n, int kind)
+{
+  std::vector<RAJA::Index_type> indices;
+  const double c = 0.5 * n;
+  const double r_outer = 0.4 * n;
+  const double r_inner = r_outer - 2.0;
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        const double dx = i + 0.5 - c;
+        const double dy = j + 0.5 - c;
+        const double dz = k + 0.5 - c;
+        const double r2 = dx * dx + dy * dy + dz * dz;
+        bool tagged = false;
+        switch (kind) {
+          case mask_sphere:
+            tagged = r2 < r_outer * r_outer;
+            break;
+          case mask_shell:
+            tagged = r2 < r_outer * r_outer && r2 >= r_inner * r_inner;
+            break;
+          default:
+            tagged = (i + j + k) % 2 == 0;
+            break;
+        }
+        if (tagged) {
+          indices.push_back(i + n * (j + n * static_cast<RAJA::Index_type>(k)));
+        }
+      }
+    }
+  }
+  return indices;
+}
+
+static void benchmark_aligned(benchmark::State& state)
+{
+  std::vector<RAJA::Index_type> indices =
+      make_mask_indices(state.range(0), state.range(1));
+  camp::resources::Resource res{camp::resources::Host()};
+
+  size_t num_segments = 0;
+  for (auto _ : state) {
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+    RAJA::buildIndexSetAligned(iset,
+                               res,
+                               indices.data(),
+                               static_cast<RAJA::Index_type>(indices.size()),
+                               32,
+                               1);
+    num_segments = iset.getNumSegments();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * indices.size());
+  state.counters["segments"] = num_segments;
+}
+
+static void benchmark_strided(benchmark::State& state)
+{
+  std::vector<RAJA::Index_type> indices =
+      make_mask_indices(state.range(0), state.range(1));
+  camp::resources::Resource res{camp::resources::Host()};
+
+  size_t num_segments = 0;
+  for (auto _ : state) {
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment> iset;
+    RAJA::Index_type* list_data = RAJA::buildIndexSetStrided(
+        iset,
+        res,
+        indices.data(),
+        static_cast<RAJA::Index_type>(indices.size()),
+        32);
+    num_segments = iset.getNumSegments();
+    benchmark::ClobberMemory();
+    res.deallocate(list_data);
+  }
+  state.SetItemsProcessed(state.iterations() * indices.size());
+  state.counters["segments"] = num_segments;
+}
+
+static void mask_sizes(benchmark::internal::Benchmark* b)
+{
+  for (int kind : {mask_sphere, mask_shell, mask_red_black}) {
+    for (int n : {128, 256, 464}) {
+      b->Args({n, kind});
+    }
+  }
+  b->ArgNames({"n", "mask"})->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(benchmark_aligned)->Name("indexset_build/aligned")->Apply(mask_sizes);
+BENCHMARK(benchmark_strided)->Name("indexset_build/strided")->Apply(mask_sizes);
+
+BENCHMARK_MAIN();
@@ -23,6 +23,7 @@
 #define VARIANT_RAJA_VECTOR          1
 #define VARIANT_RAJA_MATRIX          1
 #define VARIANT_RAJA_SEQ_SHMEM       1
+#define VARIANT_RAJA_TUNED           1
 
 #if defined(RAJA_ENABLE_OPENMP)
 #define VARIANT_RAJA_OPENMP          1
@@ -1066,6 +1067,136 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
             << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
 
 
+#if defined(DEBUG_LTIMES)
+  checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
+#endif
+}
+#endif
+
+//----------------------------------------------------------------------------//
+
+#if VARIANT_RAJA_TUNED
+{
+  std::cout << "\n Running RAJA autotuned version of LTimes...\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  //
+  // View types and Views/Layouts for indexing into arrays
+  //
+  // L(m, d) : 1 -> d is stride-1 dimension
+  using LView = TypedView<double, Layout<2, int, 1>, IM, ID>;
+
+  // psi(d, g, z) : 2 -> z is stride-1 dimension
+  using PsiView = TypedView<double, Layout<3, int, 2>, ID, IG, IZ>;
+
+  // phi(m, g, z) : 2 -> z is stride-1 dimension
+  using PhiView = TypedView<double, Layout<3, int, 2>, IM, IG, IZ>;
+
+  std::array<RAJA::idx_t, 2> L_perm {{0, 1}};
+  LView L(L_data,
+          RAJA::make_permuted_layout({{num_m, num_d}}, L_perm));
+
+  std::array<RAJA::idx_t, 3> psi_perm {{0, 1, 2}};
+  PsiView psi(psi_data,
+              RAJA::make_permuted_layout({{num_d, num_g, num_z}}, psi_perm));
+
+  std::array<RAJA::idx_t, 3> phi_perm {{0, 1, 2}};
+  PhiView phi(phi_data,
+              RAJA::make_permuted_layout({{num_m, num_g, num_z}}, phi_perm));
+
+#if defined(RAJA_ENABLE_OPENMP)
+  using TILE_EXEC = omp_parallel_for_runtime_exec;
+#else
+  using TILE_EXEC = loop_exec;
+#endif
+
+  //
+  // The g and z loops are tiled with runtime tile sizes, param 0 is the
+  // g tile size and param 1 the z tile size.
+  //
+  using EXECPOL =
+    RAJA::KernelPolicy<
+      statement::Tile<3, tile_dynamic<1>, TILE_EXEC,  // z tiles
+        statement::Tile<2, tile_dynamic<0>, loop_exec,  // g tiles
+          statement::For<0, loop_exec,  // m
+            statement::For<1, loop_exec,  // d
+              statement::For<2, loop_exec,  // g
+                statement::For<3, simd_exec,  // z
+                  statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >
+      >
+    >;
+
+  std::vector<RAJA::expt::TuningConfig> candidates;
+  for (camp::idx_t g_tile : {8, 32}) {
+    for (camp::idx_t z_tile : {512, 4096}) {
+#if defined(RAJA_ENABLE_OPENMP)
+      candidates.emplace_back(std::vector<camp::idx_t>{g_tile, z_tile},
+                              RAJA::expt::TuningSchedule::Static);
+      candidates.emplace_back(std::vector<camp::idx_t>{g_tile, z_tile},
+                              RAJA::expt::TuningSchedule::Dynamic, 1);
+#else
+      candidates.emplace_back(std::vector<camp::idx_t>{g_tile, z_tile});
+#endif
+    }
+  }
+
+  // one timed run per candidate, the cache named by RAJA_TUNING_CACHE
+  // is used instead when it has an entry for this problem size
+  RAJA::expt::KernelTuner tuner("ltimes", candidates, 1);
+  const RAJA::Index_type problem_size = num_g * num_z;
+
+  auto segments = RAJA::make_tuple(RAJA::TypedRangeSegment<IM>(0, num_m),
+                                   RAJA::TypedRangeSegment<ID>(0, num_d),
+                                   RAJA::TypedRangeSegment<IG>(0, num_g),
+                                   RAJA::TypedRangeSegment<IZ>(0, num_z));
+
+  auto ltimes = [&](const RAJA::expt::TuningConfig& config) {
+    RAJA::kernel_param<EXECPOL>( segments,
+      RAJA::make_tuple(config.tile(0), config.tile(1)),
+      [=] (IM m, ID d, IG g, IZ z, RAJA::TileSize, RAJA::TileSize) {
+         phi(m, g, z) += L(m, d) * psi(d, g, z);
+      }
+    );
+  };
+
+  RAJA::Timer tune_timer;
+  tune_timer.start();
+
+  int num_tuning_runs = 0;
+  while (!tuner.is_tuned(problem_size)) {
+    tuner.run(problem_size, ltimes);
+    ++num_tuning_runs;
+  }
+
+  tune_timer.stop();
+
+  const RAJA::expt::TuningConfig& best = tuner.get_config(problem_size);
+  std::cout << "  tuning runs: " << num_tuning_runs
+            << " (" << tune_timer.elapsed() << " sec.), tiles g = "
+            << best.tile_sizes[0] << ", z = " << best.tile_sizes[1]
+            << ", schedule = " << static_cast<int>(best.schedule) << "\n";
+
+  std::memset(phi_data, 0, phi_size * sizeof(double));
+
+  RAJA::Timer timer;
+  timer.start();
+
+  for (int iter = 0;iter < num_iter;++ iter)
+    tuner.run(problem_size, ltimes);
+
+  timer.stop();
+  double t = timer.elapsed();
+  double gflop_rate = total_flops / t / 1.0e9;
+  std::cout << "  RAJA autotuned version of LTimes run time (sec.): "
+            << timer.elapsed() <<", GFLOPS/sec: " << gflop_rate << std::endl;
+
+
 #if defined(DEBUG_LTIMES)
   checkResult(phi, L, psi, num_m, num_d, num_g, num_z);
 #endif
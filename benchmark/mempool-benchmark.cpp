@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the map based MemPool with the size class SizeClassMemPool on
+// the small short lived allocations made around kernel launches.
+//
+// The alloc/free benchmarks run on several threads at once to measure
+// contention, each thread keeps a few blocks of mixed sizes live. The
+// WorkPool benchmark enqueues, instantiates, and runs a group of short loops
+// with each allocator.
+//
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using map_pool = RAJA::basic_mempool::MemPool<
+    RAJA::basic_mempool::generic_allocator>;
+using size_class_pool = RAJA::basic_mempool::SizeClassMemPool<
+    RAJA::basic_mempool::generic_allocator>;
+
+struct MapPoolOps {
+  static char* malloc(size_t n)
+  {
+    return map_pool::getInstance().malloc<char>(n);
+  }
+  static void free(char* ptr, size_t) { map_pool::getInstance().free(ptr); }
+};
+
+struct SizeClassPoolOps {
+  static char* malloc(size_t n)
+  {
+    return size_class_pool::getInstance().malloc<char>(n);
+  }
+  static void free(char* ptr, size_t n)
+  {
+    size_class_pool::getInstance().free(ptr, n);
+  }
+};
+
+struct StdMallocOps {
+  static char* malloc(size_t n) { return static_cast<char*>(std::malloc(n)); }
+  static void free(char* ptr, size_t) { std::free(ptr); }
+};
+
+template <typename Ops>
+static void benchmark_alloc_free(benchmark::State& state)
+{
+  const size_t num_live = 8;
+  const size_t sizes[num_live] = {8, 24, 64, 200, 512, 1000, 4096, 96};
+  char* ptrs[num_live] = {};
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const size_t slot = i % num_live;
+    if (ptrs[slot] != nullptr) {
+      Ops::free(ptrs[slot], sizes[slot]);
+    }
+    ptrs[slot] = Ops::malloc(sizes[slot]);
+    benchmark::DoNotOptimize(ptrs[slot]);
+    ++i;
+  }
+
+  for (size_t slot = 0; slot < num_live; ++slot) {
+    if (ptrs[slot] != nullptr) {
+      Ops::free(ptrs[slot], sizes[slot]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+// MemPool only locks when OpenMP is enabled
+BENCHMARK_TEMPLATE(benchmark_alloc_free, MapPoolOps)
+    ->ThreadRange(1, 16)->UseRealTime();
+#else
+BENCHMARK_TEMPLATE(benchmark_alloc_free, MapPoolOps);
+#endif
+BENCHMARK_TEMPLATE(benchmark_alloc_free, SizeClassPoolOps)
+    ->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_alloc_free, StdMallocOps)
+    ->ThreadRange(1, 16)->UseRealTime();
+
+template <typename Allocator>
+static void benchmark_workpool(benchmark::State& state)
+{
+  using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::loop_work,
+                                                 RAJA::ordered,
+                                                 RAJA::ragged_array_of_objects>;
+  using workpool =
+      RAJA::WorkPool<workgroup_policy, int, RAJA::xargs<>, Allocator>;
+
+  const int num_loops = state.range(0);
+  const int len = 64;
+  std::vector<double> data(num_loops * len, 1.0);
+  double* pdata = data.data();
+
+  for (auto _ : state) {
+    workpool pool(Allocator{});
+    for (int l = 0; l < num_loops; ++l) {
+      double* ptr = pdata + l * len;
+      pool.enqueue(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+        ptr[i] += 1.0;
+      });
+    }
+    auto group = pool.instantiate();
+    auto site = group.run();
+    benchmark::DoNotOptimize(pdata[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops);
+}
+
+BENCHMARK_TEMPLATE(benchmark_workpool, std::allocator<char>)
+    ->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK_TEMPLATE(benchmark_workpool,
+                   RAJA::basic_mempool::size_class_allocator<char>)
+    ->RangeMultiplier(4)->Range(4, 256);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares OpenMP histograms built with RAJA::atomicAdd, with an atomic view,
+// and with a replicated atomic view that gives each thread a private copy of
+// the bins, including the time to merge the copies.
+//
+// Each benchmark is parameterized by the number of bins.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using hist_view_t = RAJA::View<int, RAJA::Layout<1>>;
+
+static constexpr RAJA::Index_type histogram_len = 1 << 22;
+
+static std::vector<int> make_histogram_input(int num_bins)
+{
+  std::vector<int> array(histogram_len);
+  unsigned int x = 12345u;
+  for (auto& a : array) {
+    x = x * 1664525u + 1013904223u;
+    a = static_cast<int>((x >> 8) % static_cast<unsigned int>(num_bins));
+  }
+  return array;
+}
+
+template <typename ATOMIC_POL>
+static void benchmark_atomic_add(benchmark::State& state)
+{
+  const int num_bins = state.range(0);
+  std::vector<int> array = make_histogram_input(num_bins);
+  std::vector<int> bins(num_bins, 0);
+  const int* parray = array.data();
+  int* pbins = bins.data();
+
+  for (auto _ : state) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, histogram_len), [=](RAJA::Index_type i) {
+          RAJA::atomicAdd<ATOMIC_POL>(&pbins[parray[i]], 1);
+        });
+    benchmark::DoNotOptimize(pbins);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * histogram_len);
+}
+
+template <typename ATOMIC_POL>
+static void benchmark_atomic_view(benchmark::State& state)
+{
+  const int num_bins = state.range(0);
+  std::vector<int> array = make_histogram_input(num_bins);
+  std::vector<int> bins(num_bins, 0);
+  const int* parray = array.data();
+
+  hist_view_t hist_view(bins.data(), num_bins);
+  auto hist = RAJA::make_atomic_view<ATOMIC_POL>(hist_view);
+
+  for (auto _ : state) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, histogram_len), [=](RAJA::Index_type i) {
+          hist(parray[i]) += 1;
+        });
+    benchmark::DoNotOptimize(bins.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * histogram_len);
+}
+
+template <typename ATOMIC_POL>
+static void benchmark_replicated_view(benchmark::State& state)
+{
+  const int num_bins = state.range(0);
+  std::vector<int> array = make_histogram_input(num_bins);
+  std::vector<int> bins(num_bins, 0);
+  const int* parray = array.data();
+
+  hist_view_t hist_view(bins.data(), num_bins);
+  auto hist = RAJA::make_replicated_atomic_view<ATOMIC_POL>(hist_view);
+
+  for (auto _ : state) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, histogram_len), [=](RAJA::Index_type i) {
+          hist(parray[i]) += 1;
+        });
+    hist.template merge<RAJA::omp_parallel_for_exec>();
+    benchmark::DoNotOptimize(bins.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * histogram_len);
+  state.counters["replicas"] = hist.get_num_replicas();
+}
+
+static void histogram_bins(benchmark::internal::Benchmark* b)
+{
+  for (int num_bins = 1; num_bins <= (1 << 20); num_bins *= 16) {
+    b->Arg(num_bins);
+  }
+}
+
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::omp_atomic)
+    ->Name("histogram/atomicAdd/omp_atomic")->Apply(histogram_bins);
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::builtin_atomic)
+    ->Name("histogram/atomicAdd/builtin_atomic")->Apply(histogram_bins);
+BENCHMARK_TEMPLATE(benchmark_atomic_view, RAJA::omp_atomic)
+    ->Name("histogram/atomic_view/omp_atomic")->Apply(histogram_bins);
+BENCHMARK_TEMPLATE(benchmark_replicated_view, RAJA::omp_atomic)
+    ->Name("histogram/replicated_view/omp_atomic")->Apply(histogram_bins);
+BENCHMARK_TEMPLATE(benchmark_replicated_view, RAJA::builtin_atomic)
+    ->Name("histogram/replicated_view/builtin_atomic")->Apply(histogram_bins);
+
+BENCHMARK_MAIN();
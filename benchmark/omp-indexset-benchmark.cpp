@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the OpenMP index set execution policies on an index set that
+// mixes a few long range segments with many short list segments, as built
+// for a mesh with a few large regular blocks and scattered boundary zones.
+//
+// omp_parallel_for_segit gives each thread whole segments, so the threads
+// that get the long ranges do most of the work. seq_segit with
+// omp_parallel_for_exec runs a parallel loop, with its barrier, for each
+// segment. omp_parallel_flatten_segit splits all iterations evenly across
+// the threads of one parallel region.
+//
+// Each benchmark is parameterized by the number of list segments.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define RANGE_LENGTH (1 << 22)
+#define NUM_RANGES 4
+#define LIST_LENGTH 16
+
+using ISetType = RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+static RAJA::Index_type build_iset(ISetType& iset,
+                                   std::vector<RAJA::Index_type>& lists,
+                                   int num_lists)
+{
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::Index_type next = 0;
+  for (int r = 0; r < NUM_RANGES; ++r) {
+    iset.push_back(RAJA::RangeSegment(next, next + RANGE_LENGTH));
+    next += RANGE_LENGTH;
+  }
+
+  // every other index after the ranges, so lists do not become ranges
+  lists.resize(static_cast<size_t>(num_lists) * LIST_LENGTH);
+  for (size_t i = 0; i < lists.size(); ++i) {
+    lists[i] = next + 2 * static_cast<RAJA::Index_type>(i);
+  }
+  for (int l = 0; l < num_lists; ++l) {
+    iset.push_back(
+        RAJA::ListSegment(&lists[l * LIST_LENGTH], LIST_LENGTH, res));
+  }
+
+  return next + 2 * static_cast<RAJA::Index_type>(lists.size());
+}
+
+template <typename ExecPolicy>
+static void benchmark_indexset_daxpy(benchmark::State& state)
+{
+  ISetType iset;
+  std::vector<RAJA::Index_type> lists;
+  const RAJA::Index_type n = build_iset(iset, lists, state.range(0));
+
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+  double* xp = x.data();
+  double* yp = y.data();
+
+  for (auto _ : state) {
+    RAJA::forall<ExecPolicy>(iset, [=](RAJA::Index_type i) {
+      yp[i] += 0.5 * xp[i];
+    });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * iset.getLength());
+}
+
+static void list_counts(benchmark::internal::Benchmark* b)
+{
+  for (int num_lists : {1 << 10, 1 << 14, 1 << 17}) {
+    b->Arg(num_lists);
+  }
+  b->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_indexset_daxpy,
+                   RAJA::ExecPolicy<RAJA::omp_parallel_for_segit,
+                                    RAJA::seq_exec>)
+    ->Apply(list_counts);
+BENCHMARK_TEMPLATE(benchmark_indexset_daxpy,
+                   RAJA::ExecPolicy<RAJA::seq_segit,
+                                    RAJA::omp_parallel_for_exec>)
+    ->Apply(list_counts);
+BENCHMARK_TEMPLATE(benchmark_indexset_daxpy,
+                   RAJA::ExecPolicy<RAJA::omp_parallel_flatten_segit,
+                                    RAJA::seq_exec>)
+    ->Apply(list_counts);
+
+BENCHMARK_MAIN();
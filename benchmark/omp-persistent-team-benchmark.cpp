@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Launch overhead of back-to-back small loops on the CPU.
+//
+// Each benchmark iteration is a "timestep" of NUM_LOOPS dependent daxpy
+// loops of N iterations. The loops are small enough that the cost of
+// opening an 'omp parallel' region for each one is a large part of the
+// time. Compares omp_parallel_for_exec, the persistent team policy
+// omp_persistent_for_exec, and the hand restructured version with all
+// loops in one region, plus the same loops with a reduction.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 10000
+#define NUM_LOOPS 100
+
+template <typename ExecPolicy>
+static void benchmark_back_to_back_forall(benchmark::State& state)
+{
+  std::vector<double> x(N, 1.0);
+  std::vector<double> y(N, 0.0);
+  double* xp = x.data();
+  double* yp = y.data();
+
+  for (auto _ : state) {
+    for (int loop = 0; loop < NUM_LOOPS; ++loop) {
+      const double a = (loop % 2) ? 0.5 : -0.5;
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](int i) {
+        yp[i] += a * xp[i];
+      });
+    }
+    benchmark::DoNotOptimize(yp);
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LOOPS);
+}
+
+template <typename RegionPolicy>
+static void benchmark_back_to_back_region(benchmark::State& state)
+{
+  std::vector<double> x(N, 1.0);
+  std::vector<double> y(N, 0.0);
+  double* xp = x.data();
+  double* yp = y.data();
+
+  for (auto _ : state) {
+    RAJA::region<RegionPolicy>([=]() {
+      for (int loop = 0; loop < NUM_LOOPS; ++loop) {
+        const double a = (loop % 2) ? 0.5 : -0.5;
+        RAJA::forall<RAJA::omp_for_exec>(RAJA::RangeSegment(0, N),
+                                         [=](int i) { yp[i] += a * xp[i]; });
+      }
+    });
+    benchmark::DoNotOptimize(yp);
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LOOPS);
+}
+
+template <typename ExecPolicy>
+static void benchmark_back_to_back_forall_reduce(benchmark::State& state)
+{
+  std::vector<double> x(N, 1.0);
+  double* xp = x.data();
+
+  for (auto _ : state) {
+    double total = 0.0;
+    for (int loop = 0; loop < NUM_LOOPS; ++loop) {
+      RAJA::ReduceSum<RAJA::omp_reduce, double> sum(0.0);
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                               [=](int i) { sum += xp[i]; });
+      total += sum.get();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LOOPS);
+}
+
+BENCHMARK_TEMPLATE(benchmark_back_to_back_forall, RAJA::omp_parallel_for_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_back_to_back_forall,
+                   RAJA::omp_persistent_for_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_back_to_back_region, RAJA::omp_parallel_region)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_back_to_back_region, RAJA::omp_persistent_region)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_back_to_back_forall_reduce,
+                   RAJA::omp_parallel_for_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_back_to_back_forall_reduce,
+                   RAJA::omp_persistent_for_exec)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
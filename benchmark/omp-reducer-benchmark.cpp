@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the OpenMP reduction policies on short loops that carry several
+// reducers, where combining the thread-private copies dominates the run time,
+// and the same loops with forall parameter reductions (RAJA::expt::Reduce).
+//
+// Each benchmark is parameterized by the loop length.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename REDUCE_POL>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  for (auto _ : state) {
+    RAJA::ReduceSum<REDUCE_POL, double> sum(0.0);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+          sum += pa[i];
+        });
+
+    benchmark::DoNotOptimize(sum.get());
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <typename REDUCE_POL>
+static void benchmark_reduce_many(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  std::vector<double> a(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    a[i] = static_cast<double>((i * 7919) % N);
+  }
+  double* pa = a.data();
+
+  for (auto _ : state) {
+    RAJA::ReduceSum<REDUCE_POL, double> sum(0.0);
+    RAJA::ReduceMin<REDUCE_POL, double> min(1.0e30);
+    RAJA::ReduceMax<REDUCE_POL, double> max(-1.0e30);
+    RAJA::ReduceMinLoc<REDUCE_POL, double> minloc(1.0e30, -1);
+    RAJA::ReduceMaxLoc<REDUCE_POL, double> maxloc(-1.0e30, -1);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+          sum += pa[i];
+          min.min(pa[i]);
+          max.max(pa[i]);
+          minloc.minloc(pa[i], i);
+          maxloc.maxloc(pa[i], i);
+        });
+
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+    benchmark::DoNotOptimize(minloc.getLoc());
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_reduce_sum_params(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  std::vector<double> a(N, 1.0);
+  double* pa = a.data();
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+        [=](RAJA::Index_type i, double& s) {
+          s += pa[i];
+        });
+
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_reduce_many_params(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  std::vector<double> a(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    a[i] = static_cast<double>((i * 7919) % N);
+  }
+  double* pa = a.data();
+
+  for (auto _ : state) {
+    double sum = 0.0;
+    double min = 1.0e30;
+    double max = -1.0e30;
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N),
+        RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+        RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+        RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+        [=](RAJA::Index_type i, double& s, double& mn, double& mx) {
+          s += pa[i];
+          mn = RAJA_MIN(mn, pa[i]);
+          mx = RAJA_MAX(mx, pa[i]);
+        });
+
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(min);
+    benchmark::DoNotOptimize(max);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce_ordered)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce_padded)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(benchmark_reduce_many, RAJA::omp_reduce)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_many, RAJA::omp_reduce_ordered)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(benchmark_reduce_many, RAJA::omp_reduce_padded)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+BENCHMARK(benchmark_reduce_sum_params)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(benchmark_reduce_many_params)
+    ->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Strong scaling of the OpenMP scan algorithms, from one thread up to
+// omp_get_max_threads().
+//
+// Compares the default two pass scan used by omp_parallel_for_exec with
+// the cache blocked reduce-then-scan and the single pass decoupled
+// look-back scan. The array is much larger than cache so the scans are
+// bound by memory traffic.
+//
+
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 26)
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+template <typename ExecPolicy>
+static void benchmark_inclusive_scan_inplace(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> data(N);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::fill(data.begin(), data.end(), 1.0);
+    state.ResumeTiming();
+
+    RAJA::inclusive_scan_inplace<ExecPolicy>(data);
+  }
+  state.SetBytesProcessed(state.iterations() * N * 2 * sizeof(double));
+}
+
+template <typename ExecPolicy>
+static void benchmark_exclusive_scan(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> in(N, 1.0);
+  std::vector<double> out(N);
+
+  for (auto _ : state) {
+    RAJA::exclusive_scan<ExecPolicy>(in, out);
+  }
+  state.SetBytesProcessed(state.iterations() * N * 2 * sizeof(double));
+}
+
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan_inplace,
+                   RAJA::omp_parallel_for_exec)
+    ->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan_inplace,
+                   RAJA::omp_parallel_reduce_then_scan_exec<>)
+    ->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan_inplace,
+                   RAJA::omp_parallel_lookback_scan_exec<>)
+    ->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan,
+                   RAJA::omp_parallel_for_exec)
+    ->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan,
+                   RAJA::omp_parallel_reduce_then_scan_exec<>)
+    ->Apply(thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan,
+                   RAJA::omp_parallel_lookback_scan_exec<>)
+    ->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Strong scaling of the OpenMP sort backend, from one thread up to
+// omp_get_max_threads().
+//
+// Each benchmark is parameterized by the number of OpenMP threads.
+//
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 25)
+
+static std::vector<double> const& unsorted_keys()
+{
+  static std::vector<double> keys = [] {
+    std::vector<double> k(N);
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (auto& v : k) {
+      v = dist(gen);
+    }
+    return k;
+  }();
+  return keys;
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+static void benchmark_sort(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> keys;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted_keys();
+    state.ResumeTiming();
+
+    RAJA::sort<RAJA::omp_parallel_for_exec>(keys);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_stable_sort(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> keys;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted_keys();
+    state.ResumeTiming();
+
+    RAJA::stable_sort<RAJA::omp_parallel_for_exec>(keys);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_sort_pairs(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> keys;
+  std::vector<int> vals(N);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted_keys();
+    for (int i = 0; i < N; ++i) {
+      vals[i] = i;
+    }
+    state.ResumeTiming();
+
+    RAJA::sort_pairs<RAJA::omp_parallel_for_exec>(keys, vals);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+static void benchmark_stable_sort_pairs(benchmark::State& state)
+{
+  omp_set_num_threads(state.range(0));
+  std::vector<double> keys;
+  std::vector<int> vals(N);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted_keys();
+    for (int i = 0; i < N; ++i) {
+      vals[i] = i;
+    }
+    state.ResumeTiming();
+
+    RAJA::stable_sort_pairs<RAJA::omp_parallel_for_exec>(keys, vals);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK(benchmark_sort)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(benchmark_stable_sort)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(benchmark_sort_pairs)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(benchmark_stable_sort_pairs)->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// STREAM kernels (copy, scale, add, triad) with two memory placements.
+//
+// "Serial" initializes the arrays with a serial loop, so on a NUMA system
+// all their pages are on the node of the main thread, and runs the kernels
+// with omp_parallel_for_exec. "FirstTouch" initializes the arrays with
+// RAJA::first_touch_allocate and runs the kernels with the same
+// omp_parallel_for_numa_exec mapping, so each thread streams memory on its
+// own node. Run with OMP_PLACES=cores (or threads) so threads stay bound.
+//
+
+#include <cstdlib>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 24)
+
+struct SerialPlacement {
+  using exec_policy = RAJA::omp_parallel_for_exec;
+
+  static double* allocate(size_t n, double value)
+  {
+    double* ptr = RAJA::allocate_aligned_type<double>(
+        RAJA::first_touch_page_align, n * sizeof(double));
+    for (size_t i = 0; i < n; ++i) {
+      ptr[i] = value;
+    }
+    return ptr;
+  }
+};
+
+struct FirstTouchPlacement {
+  using exec_policy = RAJA::omp_parallel_for_numa_exec;
+
+  static double* allocate(size_t n, double value)
+  {
+    return RAJA::first_touch_allocate<exec_policy>(n, value);
+  }
+};
+
+enum StreamKernel { Copy = 0, Scale, Add, Triad };
+
+template <typename Placement>
+static void benchmark_stream(benchmark::State& state)
+{
+  using EXEC_POL = typename Placement::exec_policy;
+
+  double* a = Placement::allocate(N, 1.0);
+  double* b = Placement::allocate(N, 2.0);
+  double* c = Placement::allocate(N, 0.0);
+  const double q = 3.0;
+
+  const auto kernel = static_cast<StreamKernel>(state.range(0));
+  int64_t arrays = 0;
+
+  for (auto _ : state) {
+    switch (kernel) {
+      case Copy:
+        RAJA::forall<EXEC_POL>(RAJA::RangeSegment(0, N),
+                               [=](int i) { c[i] = a[i]; });
+        arrays = 2;
+        break;
+      case Scale:
+        RAJA::forall<EXEC_POL>(RAJA::RangeSegment(0, N),
+                               [=](int i) { b[i] = q * c[i]; });
+        arrays = 2;
+        break;
+      case Add:
+        RAJA::forall<EXEC_POL>(RAJA::RangeSegment(0, N),
+                               [=](int i) { c[i] = a[i] + b[i]; });
+        arrays = 3;
+        break;
+      case Triad:
+        RAJA::forall<EXEC_POL>(RAJA::RangeSegment(0, N),
+                               [=](int i) { a[i] = b[i] + q * c[i]; });
+        arrays = 3;
+        break;
+    }
+    benchmark::DoNotOptimize(a);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * arrays * N * sizeof(double));
+
+  RAJA::free_aligned(a);
+  RAJA::free_aligned(b);
+  RAJA::free_aligned(c);
+}
+
+BENCHMARK_TEMPLATE(benchmark_stream, SerialPlacement)
+    ->ArgName("kernel")
+    ->DenseRange(Copy, Triad)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_stream, FirstTouchPlacement)
+    ->ArgName("kernel")
+    ->DenseRange(Copy, Triad)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Halo exchange packing and unpacking with OpenMP WorkGroups.
+//
+// Each benchmark iteration packs the 26 neighbor halos of NUM_VARS
+// variables on an n^3 grid into buffers with one WorkGroup and unpacks them
+// with another, so each group runs 26 * NUM_VARS small loops. Compares the
+// RAJA::ordered runner, which runs each loop with omp_parallel_for_exec,
+// against the single parallel region runners ordered_omp_single_region and
+// unordered_omp_flattened_chunks. The argument is n.
+//
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define NUM_VARS 3
+#define HALO_WIDTH 1
+
+//
+// Index lists of the 26 neighbor halos of an n^3 grid with ghost zones of
+// HALO_WIDTH, of the interior zones sent to each neighbor (pack) or of the
+// ghost zones received from it (unpack)
+//
+static std::vector<std::vector<int>> make_halo_lists(int n, bool pack)
+{
+  const int h = HALO_WIDTH;
+  const int stride_j = n + 2 * h;
+  const int stride_k = stride_j * stride_j;
+
+  // zone range in one dimension for a neighbor offset of -1, 0 or 1
+  auto range = [=](int d, int* lo, int* hi) {
+    if (d == 0) {
+      *lo = h;
+      *hi = n + h;
+    } else if (d < 0) {
+      *lo = pack ? h : 0;
+      *hi = *lo + h;
+    } else {
+      *lo = pack ? n : n + h;
+      *hi = *lo + h;
+    }
+  };
+
+  std::vector<std::vector<int>> lists;
+  for (int dk = -1; dk <= 1; ++dk) {
+    for (int dj = -1; dj <= 1; ++dj) {
+      for (int di = -1; di <= 1; ++di) {
+        if (di == 0 && dj == 0 && dk == 0) continue;
+        int i0, i1, j0, j1, k0, k1;
+        range(di, &i0, &i1);
+        range(dj, &j0, &j1);
+        range(dk, &k0, &k1);
+        std::vector<int> list;
+        for (int k = k0; k < k1; ++k) {
+          for (int j = j0; j < j1; ++j) {
+            for (int i = i0; i < i1; ++i) {
+              list.push_back(i + j * stride_j + k * stride_k);
+            }
+          }
+        }
+        lists.push_back(list);
+      }
+    }
+  }
+  return lists;
+}
+
+template <typename OrderPolicy>
+static void benchmark_halo_exchange(benchmark::State& state)
+{
+  using workgroup_policy = RAJA::WorkGroupPolicy<RAJA::omp_work,
+                                                 OrderPolicy,
+                                                 RAJA::ragged_array_of_objects>;
+  using workpool = RAJA::WorkPool<workgroup_policy,
+                                  int,
+                                  RAJA::xargs<>,
+                                  std::allocator<char>>;
+  using workgroup = RAJA::WorkGroup<workgroup_policy,
+                                    int,
+                                    RAJA::xargs<>,
+                                    std::allocator<char>>;
+  using worksite = RAJA::WorkSite<workgroup_policy,
+                                  int,
+                                  RAJA::xargs<>,
+                                  std::allocator<char>>;
+
+  const int n = static_cast<int>(state.range(0));
+  const int var_size = (n + 2 * HALO_WIDTH) * (n + 2 * HALO_WIDTH) *
+                       (n + 2 * HALO_WIDTH);
+
+  const std::vector<std::vector<int>> pack_lists = make_halo_lists(n, true);
+  const std::vector<std::vector<int>> unpack_lists = make_halo_lists(n, false);
+  const int num_neighbors = static_cast<int>(pack_lists.size());
+
+  std::vector<std::vector<double>> vars(NUM_VARS,
+                                        std::vector<double>(var_size, 1.0));
+  std::vector<std::vector<double>> buffers(num_neighbors);
+  int64_t halo_values = 0;
+  for (int l = 0; l < num_neighbors; ++l) {
+    buffers[l].resize(NUM_VARS * pack_lists[l].size());
+    halo_values += buffers[l].size();
+  }
+
+  workpool pool_pack(std::allocator<char>{});
+  workpool pool_unpack(std::allocator<char>{});
+
+  for (auto _ : state) {
+    for (int l = 0; l < num_neighbors; ++l) {
+      double* buffer = buffers[l].data();
+      const int* list = pack_lists[l].data();
+      const int len = static_cast<int>(pack_lists[l].size());
+      for (int v = 0; v < NUM_VARS; ++v) {
+        const double* var = vars[v].data();
+        pool_pack.enqueue(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+          buffer[i] = var[list[i]];
+        });
+        buffer += len;
+      }
+    }
+    workgroup group_pack = pool_pack.instantiate();
+    worksite site_pack = group_pack.run();
+
+    for (int l = 0; l < num_neighbors; ++l) {
+      const double* buffer = buffers[l].data();
+      const int* list = unpack_lists[l].data();
+      const int len = static_cast<int>(unpack_lists[l].size());
+      for (int v = 0; v < NUM_VARS; ++v) {
+        double* var = vars[v].data();
+        pool_unpack.enqueue(RAJA::TypedRangeSegment<int>(0, len), [=](int i) {
+          var[list[i]] = buffer[i];
+        });
+        buffer += len;
+      }
+    }
+    workgroup group_unpack = pool_unpack.instantiate();
+    worksite site_unpack = group_unpack.run();
+
+    benchmark::DoNotOptimize(vars[0].data());
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * halo_values);
+}
+
+BENCHMARK_TEMPLATE(benchmark_halo_exchange, RAJA::ordered)
+    ->Arg(8)->Arg(32)->Arg(100)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_halo_exchange, RAJA::ordered_omp_single_region)
+    ->Arg(8)->Arg(32)->Arg(100)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_halo_exchange, RAJA::unordered_omp_flattened_chunks)
+    ->Arg(8)->Arg(32)->Arg(100)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Runs the VectorRegister DAXPY and LTimes kernels of
+// register-dispatch-kernels.cpp with each register ISA variant that was
+// built and the CPU supports, and through the runtime dispatch, which
+// should match the widest variant.
+//
+// DAXPY is parameterized by the array length, LTimes by the number of
+// zones.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+RAJA_DEFINE_REGISTER_DISPATCH(daxpy, void(double, const double*, double*, int))
+
+RAJA_DEFINE_REGISTER_DISPATCH(ltimes,
+                              void(double*,
+                                   const double*,
+                                   const double*,
+                                   int,
+                                   int,
+                                   int,
+                                   int))
+
+static const int num_m = 25;
+static const int num_d = 80;
+static const int num_g = 32;
+
+// Runs the variant for the ISA, or the dispatched kernel for -1
+template <int ISA, typename Dispatch>
+static auto get_kernel(benchmark::State& state, Dispatch& dispatch)
+    -> decltype(dispatch.get_selected())
+{
+  if (ISA < 0) {
+    state.SetLabel(RAJA::expt::get_register_isa_name(
+        dispatch.get_selected_isa()));
+    return dispatch.get_selected();
+  }
+  const RAJA::expt::register_isa isa =
+      static_cast<RAJA::expt::register_isa>(ISA);
+  if (isa > RAJA::expt::get_cpu_register_isa() ||
+      dispatch.get(isa) == nullptr) {
+    state.SkipWithError("register ISA not built or not supported by the CPU");
+    return nullptr;
+  }
+  return dispatch.get(isa);
+}
+
+template <int ISA>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+
+  auto kernel = get_kernel<ISA>(state, daxpy_dispatch());
+  if (kernel == nullptr) {
+    return;
+  }
+
+  for (auto _ : state) {
+    if (ISA < 0) {
+      daxpy_dispatch()(1.0e-3, x.data(), y.data(), n);
+    } else {
+      kernel(1.0e-3, x.data(), y.data(), n);
+    }
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+template <int ISA>
+static void benchmark_ltimes(benchmark::State& state)
+{
+  const int num_z = state.range(0);
+  std::vector<double> L(num_m * num_d, 0.5);
+  std::vector<double> psi(num_d * num_g * num_z, 1.0);
+  std::vector<double> phi(num_m * num_g * num_z, 0.0);
+
+  auto kernel = get_kernel<ISA>(state, ltimes_dispatch());
+  if (kernel == nullptr) {
+    return;
+  }
+
+  for (auto _ : state) {
+    if (ISA < 0) {
+      ltimes_dispatch()(
+          phi.data(), L.data(), psi.data(), num_m, num_d, num_g, num_z);
+    } else {
+      kernel(phi.data(), L.data(), psi.data(), num_m, num_d, num_g, num_z);
+    }
+    benchmark::DoNotOptimize(phi.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * 2 * num_m * num_d * num_g *
+                          num_z);
+}
+
+BENCHMARK_TEMPLATE(benchmark_daxpy, 0)->Name("daxpy/scalar")
+    ->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_daxpy, 1)->Name("daxpy/avx")
+    ->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_daxpy, 2)->Name("daxpy/avx2")
+    ->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_daxpy, 3)->Name("daxpy/avx512")
+    ->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(benchmark_daxpy, -1)->Name("daxpy/dispatch")
+    ->Arg(1 << 12)->Arg(1 << 20);
+
+BENCHMARK_TEMPLATE(benchmark_ltimes, 0)->Name("ltimes/scalar")
+    ->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(benchmark_ltimes, 1)->Name("ltimes/avx")
+    ->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(benchmark_ltimes, 2)->Name("ltimes/avx2")
+    ->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(benchmark_ltimes, 3)->Name("ltimes/avx512")
+    ->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(benchmark_ltimes, -1)->Name("ltimes/dispatch")
+    ->Arg(64)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Kernels of register-dispatch-benchmark.cpp. This file is compiled once
+// for each register ISA by raja_add_register_dispatch, and VectorRegister
+// uses the widest register of that ISA.
+//
+
+#include "RAJA/RAJA.hpp"
+
+namespace RAJA_REGISTER_DISPATCH_NAMESPACE
+{
+
+RAJA_INDEX_VALUE_T(IM, int, "IM");
+RAJA_INDEX_VALUE_T(ID, int, "ID");
+RAJA_INDEX_VALUE_T(IG, int, "IG");
+RAJA_INDEX_VALUE_T(IZ, int, "IZ");
+
+// y = a * x + y
+void daxpy(double a, const double* x, double* y, int n)
+{
+  using vector_t = RAJA::expt::VectorRegister<double>;
+  using VecI = RAJA::expt::VectorIndex<int, vector_t>;
+
+  RAJA::View<const double, RAJA::Layout<1, int, 0>> X(x, n);
+  RAJA::View<double, RAJA::Layout<1, int, 0>> Y(y, n);
+
+  RAJA::forall<RAJA::expt::vector_exec<vector_t>>(
+      RAJA::TypedRangeSegment<int>(0, n),
+      [=](VecI i) { Y(i) += a * X(i); });
+}
+
+// phi(m, g, z) += L(m, d) * psi(d, g, z), with z the stride-1 dimension
+void ltimes(double* phi_data,
+            const double* L_data,
+            const double* psi_data,
+            int num_m,
+            int num_d,
+            int num_g,
+            int num_z)
+{
+  using vector_t = RAJA::expt::VectorRegister<double>;
+  using VecIZ = RAJA::expt::VectorIndex<IZ, vector_t>;
+
+  RAJA::TypedView<const double, RAJA::Layout<2, int, 1>, IM, ID>
+      L(L_data, num_m, num_d);
+  RAJA::TypedView<const double, RAJA::Layout<3, int, 2>, ID, IG, IZ>
+      psi(psi_data, num_d, num_g, num_z);
+  RAJA::TypedView<double, RAJA::Layout<3, int, 2>, IM, IG, IZ>
+      phi(phi_data, num_m, num_g, num_z);
+
+  using EXECPOL =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<2, RAJA::loop_exec,  // g
+        RAJA::statement::For<0, RAJA::loop_exec,  // m
+          RAJA::statement::For<1, RAJA::loop_exec,  // d
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+
+  auto all_z = VecIZ::all();
+
+  RAJA::kernel<EXECPOL>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<IM>(0, num_m),
+                       RAJA::TypedRangeSegment<ID>(0, num_d),
+                       RAJA::TypedRangeSegment<IG>(0, num_g)),
+      [=](IM m, ID d, IG g) {
+        phi(m, g, all_z) += L(m, d) * psi(d, g, all_z);
+      });
+}
+
+}  // namespace RAJA_REGISTER_DISPATCH_NAMESPACE
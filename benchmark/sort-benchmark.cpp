@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares RAJA::sort_pairs on arithmetic keys, which takes the radix sort
+// path, with the comparison sort selected by a user comparator.
+//
+// Each benchmark is parameterized by the number of keys.
+//
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename KEY_T>
+static std::vector<KEY_T> random_keys(RAJA::Index_type n)
+{
+  std::vector<KEY_T> keys(n);
+  std::mt19937_64 gen(12345);
+  std::uniform_int_distribution<long long> dist(-n, n);
+  for (auto& k : keys) {
+    k = static_cast<KEY_T>(dist(gen));
+  }
+  return keys;
+}
+
+template <typename EXEC_POL, typename KEY_T>
+static void benchmark_sort_pairs_radix(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  const std::vector<KEY_T> unsorted = random_keys<KEY_T>(N);
+  std::vector<KEY_T> keys;
+  std::vector<RAJA::Index_type> vals(N);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted;
+    state.ResumeTiming();
+
+    RAJA::stable_sort_pairs<EXEC_POL>(keys, vals,
+                                      RAJA::operators::less<KEY_T>{});
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <typename EXEC_POL, typename KEY_T>
+static void benchmark_sort_pairs_comparison(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  const std::vector<KEY_T> unsorted = random_keys<KEY_T>(N);
+  std::vector<KEY_T> keys;
+  std::vector<RAJA::Index_type> vals(N);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    keys = unsorted;
+    state.ResumeTiming();
+
+    RAJA::stable_sort_pairs<EXEC_POL>(keys, vals,
+                                      [](KEY_T const& a, KEY_T const& b) {
+                                        return a < b;
+                                      });
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_radix, RAJA::loop_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_comparison, RAJA::loop_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_radix, RAJA::loop_exec, double)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_comparison, RAJA::loop_exec, double)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_radix, RAJA::omp_parallel_for_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_comparison, RAJA::omp_parallel_for_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_radix, RAJA::omp_parallel_for_exec, double)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_comparison, RAJA::omp_parallel_for_exec, double)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_radix, RAJA::tbb_for_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_sort_pairs_comparison, RAJA::tbb_for_exec, int)
+    ->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
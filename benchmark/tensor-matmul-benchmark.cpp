@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares square double matrix products C = A*B:
+//
+//   reference - i,k,j loop nest the compiler may vectorize
+//   tiled     - tensor expression per register sized tile of C, which is
+//               how products too small for the packed multiply run
+//   packed    - tensor expression over whole matrices, which takes the
+//               packed multiply
+//
+// Each benchmark is parameterized by the matrix size.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using matrix_t =
+    RAJA::expt::SquareMatrixRegister<double, RAJA::expt::RowMajorLayout>;
+using row_t = RAJA::expt::RowIndex<int, matrix_t>;
+using col_t = RAJA::expt::ColIndex<int, matrix_t>;
+using view_t = RAJA::View<double, RAJA::Layout<2, int, 1>>;
+
+struct MatMulData {
+  explicit MatMulData(int n) : a(n * n), b(n * n), c(n * n, 0.0)
+  {
+    for (int i = 0; i < n * n; ++i) {
+      a[i] = 1.0 + (i % 7) * 0.25;
+      b[i] = 2.0 - (i % 5) * 0.125;
+    }
+  }
+
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> c;
+};
+
+static void set_flops(benchmark::State& state, int n)
+{
+  state.counters["flops"] = benchmark::Counter(
+      2.0 * n * n * n * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void benchmark_reference(benchmark::State& state)
+{
+  const int n = state.range(0);
+  MatMulData data(n);
+  const double* a = data.a.data();
+  const double* b = data.b.data();
+  double* c = data.c.data();
+
+  for (auto _ : state) {
+    for (int i = 0; i < n * n; ++i) {
+      c[i] = 0.0;
+    }
+    for (int i = 0; i < n; ++i) {
+      for (int k = 0; k < n; ++k) {
+        const double a_ik = a[i * n + k];
+        for (int j = 0; j < n; ++j) {
+          c[i * n + j] += a_ik * b[k * n + j];
+        }
+      }
+    }
+    benchmark::DoNotOptimize(c);
+    benchmark::ClobberMemory();
+  }
+  set_flops(state, n);
+}
+
+static void benchmark_tiled(benchmark::State& state)
+{
+  const int n = state.range(0);
+  MatMulData data(n);
+  view_t A(data.a.data(), n, n);
+  view_t B(data.b.data(), n, n);
+  view_t C(data.c.data(), n, n);
+
+  const int tile_rows = matrix_t::s_num_rows;
+  const int tile_cols = matrix_t::s_num_columns;
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; i += tile_rows) {
+      const int i_end = i + tile_rows < n ? i + tile_rows : n;
+      for (int j = 0; j < n; j += tile_cols) {
+        const int j_end = j + tile_cols < n ? j + tile_cols : n;
+        C(row_t::range(i, i_end), col_t::range(j, j_end)) =
+            A(row_t::range(i, i_end), col_t::all()) *
+            B(row_t::all(), col_t::range(j, j_end));
+      }
+    }
+    benchmark::DoNotOptimize(data.c.data());
+    benchmark::ClobberMemory();
+  }
+  set_flops(state, n);
+}
+
+static void benchmark_packed(benchmark::State& state)
+{
+  const int n = state.range(0);
+  MatMulData data(n);
+  view_t A(data.a.data(), n, n);
+  view_t B(data.b.data(), n, n);
+  view_t C(data.c.data(), n, n);
+
+  auto rows = row_t::all();
+  auto cols = col_t::all();
+
+  for (auto _ : state) {
+    C(rows, cols) = A(rows, cols) * B(rows, cols);
+    benchmark::DoNotOptimize(data.c.data());
+    benchmark::ClobberMemory();
+  }
+  set_flops(state, n);
+}
+
+BENCHMARK(benchmark_reference)->Name("matmul/reference")
+    ->Arg(64)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK(benchmark_tiled)->Name("matmul/tiled")
+    ->Arg(64)->Arg(128)->Arg(256)->Arg(512);
+BENCHMARK(benchmark_packed)->Name("matmul/packed")
+    ->Arg(64)->Arg(128)->Arg(256)->Arg(512);
+
+BENCHMARK_MAIN();
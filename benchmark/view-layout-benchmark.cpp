@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares View layouts on loops that do not walk the data along the
+// stride-1 dimension of a strided layout: a 3d 7-point stencil swept with
+// the first (i) index innermost, the same stencil in the natural order for
+// reference, and a 2d transpose. Each loop is run with RAJA::Layout,
+// RAJA::TiledLayout and RAJA::MortonLayout views.
+//
+// Each benchmark is parameterized by the extent of each dimension.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using Strided3 = RAJA::Layout<3>;
+using Tiled3 = RAJA::TiledLayout<8, 8, 8>;
+using Morton3 = RAJA::MortonLayout<3>;
+
+using Strided2 = RAJA::Layout<2>;
+using Tiled2 = RAJA::TiledLayout<32, 32>;
+using Morton2 = RAJA::MortonLayout<2>;
+
+template <typename LAYOUT, bool SWEEP_I>
+static void benchmark_stencil(benchmark::State& state)
+{
+  const int n = state.range(0);
+  const LAYOUT layout(n, n, n);
+
+  std::vector<double> in_data(layout.size(), 1.0);
+  std::vector<double> out_data(layout.size(), 0.0);
+  RAJA::View<const double, LAYOUT> in(in_data.data(), layout);
+  RAJA::View<double, LAYOUT> out(out_data.data(), layout);
+
+  auto stencil = [=](int i, int j, int k) {
+    out(i, j, k) = 0.4 * in(i, j, k) +
+                   0.1 * (in(i - 1, j, k) + in(i + 1, j, k) +
+                          in(i, j - 1, k) + in(i, j + 1, k) +
+                          in(i, j, k - 1) + in(i, j, k + 1));
+  };
+
+  for (auto _ : state) {
+    if (SWEEP_I) {
+      for (int k = 1; k < n - 1; ++k) {
+        for (int j = 1; j < n - 1; ++j) {
+          for (int i = 1; i < n - 1; ++i) {
+            stencil(i, j, k);
+          }
+        }
+      }
+    } else {
+      for (int i = 1; i < n - 1; ++i) {
+        for (int j = 1; j < n - 1; ++j) {
+          for (int k = 1; k < n - 1; ++k) {
+            stencil(i, j, k);
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(out_data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2) * (n - 2));
+}
+
+template <typename LAYOUT>
+static void benchmark_transpose(benchmark::State& state)
+{
+  const int n = state.range(0);
+  const LAYOUT layout(n, n);
+
+  std::vector<double> a_data(layout.size(), 1.0);
+  std::vector<double> b_data(layout.size(), 0.0);
+  RAJA::View<const double, LAYOUT> a(a_data.data(), layout);
+  RAJA::View<double, LAYOUT> b(b_data.data(), layout);
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        b(j, i) = a(i, j);
+      }
+    }
+    benchmark::DoNotOptimize(b_data.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_stencil, Strided3, true)->Arg(64)->Arg(128);
+BENCHMARK_TEMPLATE(benchmark_stencil, Tiled3, true)->Arg(64)->Arg(128);
+BENCHMARK_TEMPLATE(benchmark_stencil, Morton3, true)->Arg(64)->Arg(128);
+
+BENCHMARK_TEMPLATE(benchmark_stencil, Strided3, false)->Arg(64)->Arg(128);
+BENCHMARK_TEMPLATE(benchmark_stencil, Tiled3, false)->Arg(64)->Arg(128);
+BENCHMARK_TEMPLATE(benchmark_stencil, Morton3, false)->Arg(64)->Arg(128);
+
+BENCHMARK_TEMPLATE(benchmark_transpose, Strided2)
+    ->Arg(512)->Arg(1024)->Arg(2048);
+BENCHMARK_TEMPLATE(benchmark_transpose, Tiled2)
+    ->Arg(512)->Arg(1024)->Arg(2048);
+BENCHMARK_TEMPLATE(benchmark_transpose, Morton2)
+    ->Arg(512)->Arg(1024)->Arg(2048);
+
+BENCHMARK_MAIN();
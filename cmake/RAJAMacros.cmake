@@ -206,3 +206,119 @@ macro(raja_add_benchmark)
     NAME ${arg_NAME}
     COMMAND ${TEST_DRIVER} ${arg_NAME})
 endmacro(raja_add_benchmark)
+
+# raja_add_register_dispatch needs the GNU style -m ISA flags, and an ELF
+# linker, objcopy and nm to keep the per-ISA copies of inline code apart.
+set(RAJA_REGISTER_DISPATCH_SCRIPT
+  ${CMAKE_CURRENT_LIST_DIR}/RAJARegisterDispatchObject.cmake)
+if (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang|IntelLLVM" AND
+    CMAKE_EXECUTABLE_FORMAT STREQUAL "ELF" AND
+    CMAKE_LINKER AND CMAKE_OBJCOPY AND CMAKE_NM)
+  set(RAJA_REGISTER_DISPATCH_SUPPORTED On)
+else ()
+  set(RAJA_REGISTER_DISPATCH_SUPPORTED Off)
+endif ()
+
+# Compiles SOURCES once for each CPU register ISA and adds the objects to
+# TARGET, for kernels selected at runtime with RAJA_DEFINE_REGISTER_DISPATCH.
+# The ISAs default to scalar, avx, avx2 and avx512 on x86 and to scalar
+# elsewhere, and can be set with RAJA_REGISTER_DISPATCH_ISAS. Each variant
+# is linked into one object in which only its kernels are global, see
+# RAJARegisterDispatchObject.cmake. Requires RAJA_REGISTER_DISPATCH_SUPPORTED.
+macro(raja_add_register_dispatch)
+  set(options )
+  set(singleValueArgs TARGET)
+  set(multiValueArgs SOURCES DEPENDS_ON)
+
+  cmake_parse_arguments(arg
+    "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  if (NOT RAJA_REGISTER_DISPATCH_SUPPORTED)
+    message(FATAL_ERROR "raja_add_register_dispatch requires a GNU, Clang or "
+      "IntelLLVM compiler and an ELF linker, objcopy and nm")
+  endif ()
+
+  list (APPEND arg_DEPENDS_ON RAJA)
+
+  if (RAJA_ENABLE_OPENMP)
+    list (APPEND arg_DEPENDS_ON openmp)
+  endif ()
+
+  set(_dispatch_x86 Off)
+  if (CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|amd64|i.86")
+    set(_dispatch_x86 On)
+  endif ()
+
+  if (DEFINED RAJA_REGISTER_DISPATCH_ISAS)
+    set(_dispatch_isas ${RAJA_REGISTER_DISPATCH_ISAS})
+  elseif (_dispatch_x86)
+    set(_dispatch_isas scalar avx avx2 avx512)
+  else ()
+    set(_dispatch_isas scalar)
+  endif ()
+
+  foreach (_dispatch_isa ${_dispatch_isas})
+    set(_dispatch_lib ${arg_TARGET}-${_dispatch_isa})
+
+    blt_add_library(
+      NAME ${_dispatch_lib}
+      SOURCES ${arg_SOURCES}
+      DEPENDS_ON ${arg_DEPENDS_ON}
+      OBJECT TRUE)
+
+    blt_add_target_definitions(
+      TO ${_dispatch_lib}
+      SCOPE PRIVATE
+      TARGET_DEFINITIONS RAJA_REGISTER_DISPATCH_ISA=${_dispatch_isa})
+
+    # the scalar variant is held to the x86 baseline even if the build uses
+    # -march flags, and no variant is compiled to LTO bytecode, which cannot
+    # be localized
+    set(_dispatch_flags -fno-lto)
+    if (_dispatch_isa STREQUAL "scalar")
+      if (_dispatch_x86)
+        list(APPEND _dispatch_flags -mno-avx)
+      endif ()
+    elseif (_dispatch_isa STREQUAL "avx")
+      list(APPEND _dispatch_flags -mavx)
+    elseif (_dispatch_isa STREQUAL "avx2")
+      list(APPEND _dispatch_flags -mavx2 -mfma)
+    elseif (_dispatch_isa STREQUAL "avx512")
+      list(APPEND _dispatch_flags -mavx512f -mfma)
+    else ()
+      message(FATAL_ERROR "Unknown register dispatch ISA ${_dispatch_isa}")
+    endif ()
+
+    blt_add_target_compile_flags(
+      TO ${_dispatch_lib}
+      FLAGS ${_dispatch_flags})
+
+    set(_dispatch_object
+      ${CMAKE_CURRENT_BINARY_DIR}/${_dispatch_lib}${CMAKE_CXX_OUTPUT_EXTENSION})
+
+    add_custom_command(
+      OUTPUT ${_dispatch_object}
+      COMMAND ${CMAKE_COMMAND}
+        -DLINKER=${CMAKE_LINKER}
+        -DOBJCOPY=${CMAKE_OBJCOPY}
+        -DNM=${CMAKE_NM}
+        -DNAMESPACE=raja_register_${_dispatch_isa}
+        "-DOBJECTS=$<TARGET_OBJECTS:${_dispatch_lib}>"
+        -DOUTPUT=${_dispatch_object}
+        -P ${RAJA_REGISTER_DISPATCH_SCRIPT}
+      DEPENDS
+        ${_dispatch_lib}
+        $<TARGET_OBJECTS:${_dispatch_lib}>
+        ${RAJA_REGISTER_DISPATCH_SCRIPT}
+      COMMENT "Localizing the ${_dispatch_isa} variant of ${arg_TARGET}"
+      VERBATIM)
+
+    target_sources(${arg_TARGET} PRIVATE ${_dispatch_object})
+
+    string(TOUPPER ${_dispatch_isa} _dispatch_isa_upper)
+    blt_add_target_definitions(
+      TO ${arg_TARGET}
+      SCOPE PRIVATE
+      TARGET_DEFINITIONS RAJA_REGISTER_DISPATCH_HAVE_${_dispatch_isa_upper})
+  endforeach ()
+endmacro(raja_add_register_dispatch)
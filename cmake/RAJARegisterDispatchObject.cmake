@@ -0,0 +1,75 @@
+###############################################################################
+# Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+# and other RAJA project contributors. See the RAJA/LICENSE file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+################################################################################
+
+#
+# Run by raja_add_register_dispatch in script mode (cmake -P) to combine the
+# objects of one register ISA variant into OUTPUT:
+#
+#   cmake -DLINKER=... -DOBJCOPY=... -DNM=... -DNAMESPACE=...
+#         -DOBJECTS=... -DOUTPUT=... -P RAJARegisterDispatchObject.cmake
+#
+# Every variant compiles the same RAJA, camp and standard library inline
+# functions and templates with its own ISA flags. As weak or COMDAT symbols
+# the linker would keep a single copy for all variants, e.g. an AVX-512 one
+# called from the scalar kernels. The objects are therefore linked into one
+# relocatable object in which all code except the kernels in NAMESPACE is
+# made local and the COMDAT groups are dropped. Data such as function-local
+# statics and typeinfo stays global, as weak symbols, and is shared with the
+# rest of the program, vtables stay local since they point to code of the
+# variant.
+#
+
+foreach (_var LINKER OBJCOPY NM NAMESPACE OBJECTS OUTPUT)
+  if (NOT ${_var})
+    message(FATAL_ERROR "RAJARegisterDispatchObject.cmake requires ${_var}")
+  endif ()
+endforeach ()
+
+execute_process(
+  COMMAND ${LINKER} -r -o ${OUTPUT} ${OBJECTS}
+  RESULT_VARIABLE _result)
+if (NOT _result EQUAL 0)
+  message(FATAL_ERROR "Linking ${OUTPUT} failed")
+endif ()
+
+execute_process(
+  COMMAND ${NM} --defined-only ${OUTPUT}
+  OUTPUT_VARIABLE _symbols
+  RESULT_VARIABLE _result)
+if (NOT _result EQUAL 0)
+  message(FATAL_ERROR "Listing the symbols of ${OUTPUT} failed")
+endif ()
+
+# global data symbols (B, D, G, R, S, V) and unique globals (u), but not
+# vtables, VTTs and construction vtables
+set(_keep "")
+string(REGEX MATCHALL "[^\n]+" _lines "${_symbols}")
+foreach (_line ${_lines})
+  if (_line MATCHES " [BDGRSVu] ([^ ]+)$")
+    set(_symbol ${CMAKE_MATCH_1})
+    if (NOT _symbol MATCHES "^_ZT[VTC]")
+      string(APPEND _keep "${_symbol}\n")
+    endif ()
+  endif ()
+endforeach ()
+file(WRITE ${OUTPUT}.symbols "${_keep}")
+
+# mangled names of the kernels contain the length prefixed namespace
+string(LENGTH ${NAMESPACE} _length)
+
+execute_process(
+  COMMAND ${OBJCOPY}
+    --wildcard
+    --keep-global-symbols=${OUTPUT}.symbols
+    --keep-global-symbol=*${_length}${NAMESPACE}*
+    --weaken-symbols=${OUTPUT}.symbols
+    --remove-section=.group
+    ${OUTPUT}
+  RESULT_VARIABLE _result)
+if (NOT _result EQUAL 0)
+  message(FATAL_ERROR "Localizing the symbols of ${OUTPUT} failed")
+endif ()
@@ -1,17 +1,28 @@
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
 #include "RAJA/RAJA.hpp"
 
-int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
+/*
+ *  Dynamic tile sizes and their runtime tuning
+ *
+ *  The first kernel shows tile_dynamic, whose tile sizes are kernel
+ *  parameters. The second tunes the tile sizes (and, with OpenMP, the loop
+ *  schedule) of a tiled transpose with RAJA::expt::KernelTuner.
+ *
+ *  The tuned configurations can be saved and reused:
+ *
+ *    ./kernel-dynamic-tile cache.txt   # tunes and writes cache.txt
+ *    ./kernel-dynamic-tile cache.txt   # starts with the tuned sizes
+ *
+ *  Setting RAJA_TUNING_CACHE=cache.txt loads the file in any application.
+ */
+
+int main(int argc, char **argv)
 {
   std::cout << "\n\nRAJA dynamic_tile example...\n\n";
 
-//Using policy = KernelPolicy<Tile<tile_dynamic<0>, seq_exec, …>>;
-//RAJA::kernel_param<policy>(
-// make_tuple(RangeSegment(0,N)),
-//  make_tuple(32),  // param 0 is referenced by tile_dynamic
-//  [=](int i, int tile_size){
-//
-//  });
-
   using namespace RAJA;
 
   kernel_param<
@@ -26,9 +37,93 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
     >
   >(make_tuple(RangeSegment{0,25}, RangeSegment{0,25}),
       make_tuple(TileSize{5}, TileSize{10}),
-     //make_tuple(TileSize(10)), // not sure we need this, good for static_assert
      [=](int i, int j, TileSize x, TileSize y){
        std::cout << "Running index (" << i << "," << j << ") of " << x.size << "x" << y.size << " tile." << std::endl;
   });
 
+
+  std::cout << "\n\nRAJA autotuned dynamic_tile example...\n\n";
+
+  const char* cache_file = argc > 1 ? argv[1] : nullptr;
+  if (cache_file && expt::TuningCache::get_default().load(cache_file)) {
+    std::cout << "Loaded tuning cache " << cache_file << "\n";
+  }
+
+  const int N = 2048;
+  std::vector<double> A(N * N), At(N * N);
+  for (int i = 0; i < N * N; ++i) {
+    A[i] = i;
+  }
+
+  View<double, Layout<2>> Aview(A.data(), N, N);
+  View<double, Layout<2>> Atview(At.data(), N, N);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  using outer_tile_exec = omp_parallel_for_runtime_exec;
+#else
+  using outer_tile_exec = seq_exec;
+#endif
+
+  using TransposePolicy =
+    KernelPolicy<
+      statement::Tile<1, tile_dynamic<1>, outer_tile_exec,
+        statement::Tile<0, tile_dynamic<0>, seq_exec,
+          statement::For<1, seq_exec,
+            statement::For<0, seq_exec, statement::Lambda<0>>
+          >
+        >
+      >
+    >;
+
+  // candidate {column tile, row tile} sizes and schedules of the row tiles
+  std::vector<expt::TuningConfig> candidates;
+  for (camp::idx_t col_tile : {16, 64, 256}) {
+    for (camp::idx_t row_tile : {4, 16, 64}) {
+      candidates.emplace_back(std::vector<camp::idx_t>{col_tile, row_tile});
+#if defined(RAJA_ENABLE_OPENMP)
+      candidates.emplace_back(std::vector<camp::idx_t>{col_tile, row_tile},
+                              expt::TuningSchedule::Dynamic, 1);
+#endif
+    }
+  }
+
+  expt::KernelTuner tuner("transpose", candidates);
+
+  const int num_runs = static_cast<int>(3 * candidates.size()) + 10;
+  for (int run = 0; run < num_runs; ++run) {
+    tuner.run(N * N, [&](const expt::TuningConfig& config) {
+      kernel_param<TransposePolicy>(
+          make_tuple(RangeSegment{0, N}, RangeSegment{0, N}),
+          make_tuple(config.tile(0), config.tile(1)),
+          [=](int col, int row, TileSize, TileSize) {
+            Atview(col, row) = Aview(row, col);
+          });
+    });
+  }
+
+  const expt::TuningConfig& best = tuner.get_config(N * N);
+  std::cout << "Tuned tile sizes " << best.tile_sizes[0] << " x "
+            << best.tile_sizes[1] << ", schedule "
+            << static_cast<int>(best.schedule) << "\n";
+
+  bool correct = true;
+  for (int row = 0; row < N && correct; ++row) {
+    for (int col = 0; col < N; ++col) {
+      if (Atview(col, row) != Aview(row, col)) {
+        correct = false;
+        break;
+      }
+    }
+  }
+  std::cout << (correct ? "\tresult -- PASS\n" : "\tresult -- FAIL\n");
+
+  if (cache_file) {
+    if (expt::TuningCache::get_default().save(cache_file)) {
+      std::cout << "Saved tuning cache " << cache_file << "\n";
+    } else {
+      std::cout << "Could not write tuning cache " << cache_file << "\n";
+    }
+  }
+
+  return 0;
 }
@@ -411,6 +411,94 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   checkResult<double>(Cview, N);
 //printResult<double>(Cview, N);
+
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running OpenMP tiled mat-mult with host teams ...\n";
+
+  std::memset(C, 0, N*N * sizeof(double));
+
+  //
+  // The tiled kernel with shared memory below, run by host teams of two
+  // OpenMP threads. Each team gets its own team shared memory, sized by the
+  // Grid, in which its tiles stay in cache, and teamSync() is a barrier of
+  // the two threads of the team.
+  //
+  using omp_team_launch_policy =
+    RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<2>>;
+
+  using omp_teams = RAJA::expt::LoopPolicy<RAJA::omp_team_loop_exec>;
+
+  using omp_threads = RAJA::expt::LoopPolicy<RAJA::omp_team_thread_loop_exec>;
+
+  using omp_seq_loop = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+  RAJA::expt::launch<omp_team_launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Grid(RAJA::expt::Teams(NTeams,NTeams),
+                     RAJA::expt::Threads(THREAD_SZ,THREAD_SZ),
+                     RAJA::expt::SharedMem(3 * THREAD_SZ * THREAD_SZ *
+                                           sizeof(double))),
+     [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+   RAJA::expt::tile<omp_teams>
+     (ctx, THREAD_SZ, row_range, [&] (RAJA::RangeSegment const &y_tile) {
+     RAJA::expt::tile<omp_teams>
+       (ctx, THREAD_SZ, col_range, [&] (RAJA::RangeSegment const &x_tile) {
+
+         double *As = ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ);
+         double *Bs = ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ);
+         double *Cs = ctx.getSharedMemory<double>(THREAD_SZ * THREAD_SZ);
+
+         RAJA::expt::loop_icount<omp_threads>(ctx, y_tile, [&](int RAJA_UNUSED_ARG(row), int ty) {
+             RAJA::expt::loop_icount<omp_seq_loop>(ctx, x_tile, [&](int RAJA_UNUSED_ARG(col), int tx) {
+               Cs[tx + THREAD_SZ*ty] = 0.0;
+             });
+         });
+
+         RAJA::expt::tile<omp_seq_loop>
+           (ctx, THREAD_SZ, dot_range, [&] (RAJA::RangeSegment const &k_tile) {
+
+           RAJA::expt::loop_icount<omp_threads>(ctx, y_tile, [&](int row, int ty) {
+               RAJA::expt::loop_icount<omp_seq_loop>(ctx, k_tile, [&](int k_id, int tx) {
+                   As[tx + THREAD_SZ*ty] = Aview(row,k_id);
+                 });
+             });
+
+           RAJA::expt::loop_icount<omp_threads>(ctx, k_tile, [&](int k_id, int ty) {
+               RAJA::expt::loop_icount<omp_seq_loop>(ctx, x_tile, [&](int col, int tx) {
+                   Bs[tx + THREAD_SZ*ty] = Bview(k_id,col);
+               });
+             });
+
+           ctx.teamSync();
+
+           RAJA::expt::loop_icount<omp_threads>(ctx, y_tile, [&](int RAJA_UNUSED_ARG(row), int ty) {
+               RAJA::expt::loop_icount<omp_seq_loop>(ctx, x_tile, [&](int RAJA_UNUSED_ARG(col), int tx) {
+
+                   RAJA::expt::loop_icount<omp_seq_loop>(ctx, k_tile, [&] (int RAJA_UNUSED_ARG(gid), int e) {
+                       Cs[tx + THREAD_SZ*ty] += As[e + THREAD_SZ*ty] * Bs[tx + THREAD_SZ*e];
+                     });
+
+                 });
+             });
+
+           ctx.teamSync();
+
+         });  // slide across matrix
+
+         RAJA::expt::loop_icount<omp_threads>(ctx, y_tile, [&](int row, int ty) {
+             RAJA::expt::loop_icount<omp_seq_loop>(ctx, x_tile, [&](int col, int tx) {
+                 Cview(row,col) = Cs[tx + THREAD_SZ*ty];
+             });
+         });
+
+         ctx.releaseSharedMemory();
+       });
+     });
+  });  // kernel
+
+  checkResult<double>(Cview, N);
+//printResult<double>(Cview, N);
 #endif // if RAJA_ENABLE_OPENMP
 
 //----------------------------------------------------------------------------//
@@ -295,7 +295,7 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
 #if defined(RAJA_ENABLE_OPENMP)
 //
-// Run the previous version in parallel (2 different ways) just for fun...
+// Run the previous version in parallel (3 different ways) just for fun...
 //
 
   std::cout << 
@@ -336,6 +336,27 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
 
   checkResult(a, aref, N);
 //printResult(a, N);
+
+
+//----------------------------------------------------------------------------//
+
+  std::cout << 
+    "\n Running RAJA index set (2 RangeSegments, 1 ListSegment) daxpy\n" << 
+    " (OpenMP parallel iteration over all segment iterations, split evenly)...\n";
+
+  std::memcpy( a, a0, N * sizeof(double) );
+
+  // _raja_indexset_ompflattenpolicy_daxpy_start
+  using OMP_ISET_EXECPOL3 = RAJA::ExecPolicy<RAJA::omp_parallel_flatten_segit,
+                                             RAJA::seq_exec>;
+  // _raja_indexset_ompflattenpolicy_daxpy_end
+
+  RAJA::forall<OMP_ISET_EXECPOL3>(is3, [=] (IdxType i) {
+    a[i] += b[i] * c;
+  });
+
+  checkResult(a, aref, N);
+//printResult(a, N);
 #endif
 
 //----------------------------------------------------------------------------//
@@ -299,6 +299,45 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   checkResult(vertexvol, vertexvol_ref, N_vert);
 //std::cout << "\n Vertex volumes...\n";
 //printMeshData(vertexvol, N_vert, jvoff); 
+
+//
+// RAJA vertex volume calculation - OpenMP version with a color index set
+// built from the element to vertex connectivity. The colors are computed
+// in parallel, so the same code works for unstructured meshes, where the
+// colors cannot be written down by hand as above.
+//
+  std::cout << "\n Running RAJA OpenMP built color index set version...\n";
+
+  std::vector<RAJA::Index_type> elem2vert_offsets(N_elem*N_elem + 1);
+  std::vector<RAJA::Index_type> elem2vert(4*N_elem*N_elem);
+  for (int ie = 0 ; ie <= N_elem*N_elem ; ++ie) {
+    elem2vert_offsets[ie] = 4 * ie;
+  }
+  for (int k = 0 ; k < 4*N_elem*N_elem ; ++k) {
+    elem2vert[k] = elem2vert_map[k];
+  }
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> builtcolorset;
+
+  RAJA::buildLockFreeColorIndexsetCSR(builtcolorset, host_res,
+                                      elem2vert_offsets.data(),
+                                      elem2vert.data(),
+                                      N_elem*N_elem, N_vert*N_vert);
+
+  std::cout << "\n Number of colors: " << builtcolorset.getNumSegments()
+            << "\n";
+
+  std::memset(vertexvol, 0, N_vert*N_vert * sizeof(double));
+
+  RAJA::forall<EXEC_POL3>(builtcolorset, [=](int ie) {
+    int* iv = &(elem2vert_map[4*ie]);
+    vertexvol[ iv[0] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[1] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[2] ] += elemvol[ie] / 4.0 ;
+    vertexvol[ iv[3] ] += elemvol[ie] / 4.0 ;
+  });
+
+  checkResult(vertexvol, vertexvol_ref, N_vert);
 #endif
 
 //----------------------------------------------------------------------------//
@@ -119,6 +119,8 @@
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
+#include "RAJA/util/TiledLayout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/View.hpp"
 
 
@@ -193,6 +195,28 @@
 
 #include "RAJA/pattern/sort.hpp"
 
+#include "RAJA/pattern/compaction.hpp"
+
+//
+// Asynchronous host resource
+//
+#include "RAJA/pattern/host_async.hpp"
+
+//
+// First-touch memory placement
+//
+#include "RAJA/util/first_touch.hpp"
+
+//
+// Replicated atomic views
+//
+#include "RAJA/util/ReplicatedAtomicView.hpp"
+
+//
+// Runtime tuning of kernel configurations
+//
+#include "RAJA/util/KernelTuner.hpp"
+
 namespace RAJA {
 namespace expt{}
   // provide a RAJA::expt namespace for experimental work, but bring alias
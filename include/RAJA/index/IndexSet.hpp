@@ -23,6 +23,7 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -608,6 +609,7 @@ public:
     segment_types = c.segment_types;
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
+    m_dep_graph = c.m_dep_graph;
     m_len = c.m_len;
   }
 
@@ -618,9 +620,70 @@ public:
     swap(segment_types, other.segment_types);
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
+    swap(m_dep_graph, other.m_dep_graph);
     swap(m_len, other.m_len);
   }
 
+  //!  @name TypedIndexSet segment dependency graph methods
+  ///
+  /// A dependency graph orders the execution of segments by taskgraph
+  /// segment iteration policies. Each segment has a node holding the ids of
+  /// the segments that may not execute until it completes.
+  ///
+  /// Build a graph by calling initDependencyGraph() after all segments have
+  /// been added, adding forward-dependencies to the node of each segment,
+  /// and calling finalizeDependencyGraph(). The graph is reused each time
+  /// the index set is executed.
+  ///
+
+  //! Allocate a dependency graph node, with no dependencies, per segment
+  void initDependencyGraph()
+  {
+    m_dep_graph.clear();
+    m_dep_graph.resize(segment_types.size());
+  }
+
+  //! Set the dependency count of each node from the graph edges
+  void finalizeDependencyGraph()
+  {
+    size_t num_seg = m_dep_graph.size();
+    for (size_t i = 0; i < num_seg; ++i) {
+      m_dep_graph[i].semaphoreReloadValue() = 0;
+    }
+    for (size_t i = 0; i < num_seg; ++i) {
+      DepGraphNode const &node = m_dep_graph[i];
+      for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+        ++m_dep_graph[node.depTaskNum(ii)].semaphoreReloadValue();
+      }
+    }
+    resetDependencyGraph();
+  }
+
+  //! Ready all dependency graph nodes to be executed again
+  void resetDependencyGraph()
+  {
+    size_t num_seg = m_dep_graph.size();
+    for (size_t i = 0; i < num_seg; ++i) {
+      m_dep_graph[i].reset();
+    }
+  }
+
+  //! Returns true if there is a dependency graph node for each segment
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph.size() != 0 &&
+           m_dep_graph.size() == segment_types.size();
+  }
+
+  //! Get dependency graph node of specified segment
+  DepGraphNode *getDepGraphNode(int segid) { return &m_dep_graph[segid]; }
+
+  //! Get dependency graph node of specified segment
+  DepGraphNode const *getDepGraphNode(int segid) const
+  {
+    return &m_dep_graph[segid];
+  }
+
 protected:
   RAJA_INLINE static size_t getNumTypes() { return 0; }
 
@@ -752,6 +815,9 @@ private:
   //! the icount of each segment
   RAJA::RAJAVec<Index_type> segment_icounts;
 
+  //! dependency graph node of each segment:    seg_index -> node
+  RAJA::RAJAVec<DepGraphNode> m_dep_graph;
+
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
 };
@@ -62,6 +62,73 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_align);
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate an index set with Range, RangeStride and List segments,
+ *        as needed, from given array of indices.
+ *
+ *        The input array is split across OpenMP threads, each of which
+ *        finds the runs of indices with a constant stride in its part.
+ *        Runs that cross a thread boundary are merged. Runs of at least
+ *        range_min_length indices become RangeSegments (stride 1) or
+ *        RangeStrideSegments, and the indices between them become
+ *        ListSegments. The indices of all list segments are gathered into
+ *        one allocation in work_res.
+ *
+ *        Routine does no error-checking on arguments and assumes
+ *        RAJA::Index_type array contains valid indices.
+ *
+ *  \param iset reference to index set generated with range, range stride,
+ *         and list segments. Method assumes index set is empty (no segments).
+ *  \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live.
+ *  \param indices_in pointer to start of input array of indices.
+ *  \param length size of input index array.
+ *  \param range_min_length min length of any range or range stride segment
+ *         in index set.
+ *
+ *  \return pointer to the list segment index data, allocated with work_res,
+ *          or nullptr if the index set has no list segments. The list
+ *          segments do not own their data; the caller deallocates it with
+ *          work_res once the index set is no longer used.
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type* RAJASHAREDDLL_API buildIndexSetStrided(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length);
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Same as RAJA::buildIndexSetStrided, but scans the index array in
+ *        num_chunks parts instead of one part per OpenMP thread, so that the
+ *        merging of runs across part boundaries can be tested in any build.
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type* RAJASHAREDDLL_API buildIndexSetStrided(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    int num_chunks);
+
+}  // namespace detail
+
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -126,6 +193,54 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a lock-free "color" index set from CSR connectivity,
+ *        coloring in parallel.
+ *
+ *        Domain entity i is connected to the range entities
+ *        domainToRange[domainOffsets[i]] ... domainToRange[domainOffsets[i+1]-1],
+ *        so entities may have different numbers of range entities. Two
+ *        domain entities with a common range entity get different colors.
+ *        Coloring is speculative greedy with conflict repair: entities are
+ *        colored in parallel with OpenMP, and conflicting colors are
+ *        repaired in further parallel rounds.
+ *
+ *        The index set holds one segment per color, with its entities in
+ *        ascending order. It can be run with
+ *        ExecPolicy<seq_segit, omp_parallel_for_exec> so that no two
+ *        concurrent iterations update the same range entity.
+ *
+ *        Routine does no error-checking on arguments and assumes the
+ *        connectivity arrays contain valid indices.
+ *
+ * \param iset reference to index set generated. Method assumes index set
+ *        is empty (no segments).
+ * \param work_res camp resource object that identifies the memory space in
+ *         which list segment index data will live (passed to list segment
+ *         ctor).
+ * \param domainOffsets array of numEntity + 1 offsets into domainToRange.
+ * \param domainToRange range entities of each domain entity.
+ * \param numEntity number of domain entities.
+ * \param numEntityRange number of range entities.
+ * \param blockSize number of consecutive domain entities colored as one
+ *        block; the entities within a block are then split by a second
+ *        coloring. 1 gives the fewest colors. Larger blocks confine each
+ *        color to fewer regions of the domain, improving locality within
+ *        each color, at the cost of more colors.
+ *
+ ******************************************************************************
+ */
+void RAJASHAREDDLL_API buildLockFreeColorIndexsetCSR(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainOffsets,
+    RAJA::Index_type const* domainToRange,
+    RAJA::Index_type numEntity,
+    RAJA::Index_type numEntityRange,
+    RAJA::Index_type blockSize = 1);
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -24,7 +24,7 @@
 #include <atomic>
 #include <cstdlib>
 #include <iosfwd>
-#include <thread>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -37,27 +37,41 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         The semaphore counts the dependencies that remain unsatisfied
+ *         before the task may execute; the reload value is the total
+ *         number of dependencies, restored by reset() so the same graph
+ *         can be executed again. A node may have any number of
+ *         forward-dependencies.
+ *
  ******************************************************************************
  */
-class RAJA_ALIGNED_ATTR(256) DepGraphNode
+class DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
+  /// Default ctor initializes node to default state.
+  ///
+  DepGraphNode() : m_semaphore_reload_value(0), m_semaphore_value(0) {}
+
   ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// Copy ctor copies the current semaphore value.
   ///
-  static const int _MaxDepTasks_ = 8;
+  DepGraphNode(const DepGraphNode& other)
+      : m_dep_tasks(other.m_dep_tasks),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_semaphore_value(other.m_semaphore_value.load())
+  {
+  }
 
   ///
-  /// Default ctor initializes node to default state.
+  /// Copy-assignment operator copies the current semaphore value.
   ///
-  DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+  DepGraphNode& operator=(const DepGraphNode& other)
   {
+    m_dep_tasks = other.m_dep_tasks;
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    return *this;
   }
 
   ///
@@ -78,39 +92,38 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency.
   ///
-  void satisfyOne()
+  /// Returns true if this satisfied the last outstanding dependency, in
+  /// which case the caller is responsible for scheduling this task.
+  ///
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
+    return m_semaphore_value.fetch_sub(1, std::memory_order_acq_rel) == 1;
   }
 
   ///
-  /// Wait for all dependencies to be satisfied
+  /// Add a "forward-dependency" for this task; i.e., an external task
+  /// that cannot execute until this task completes.
   ///
-  void wait()
-  {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
-    }
-  }
+  void addDepTask(int task) { m_dep_tasks.push_back(task); }
+
+  ///
+  /// Remove all forward-dependencies of this task.
+  ///
+  void clearDepTasks() { m_dep_tasks.clear(); }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
-  /// number of external tasks that cannot execute until this task completes.
+  /// Get the number of "forward-dependencies" for this task.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_tasks.size()); }
 
   ///
-  /// Get/set the forward dependency task number associated with the given
+  /// Get the forward dependency task number associated with the given
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int depTaskNum(int tidx) const { return m_dep_tasks[tidx]; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,8 +131,7 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
+  std::vector<int> m_dep_tasks;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
 };
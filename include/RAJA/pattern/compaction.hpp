@@ -0,0 +1,420 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA copy_if, partition, stable_partition,
+*          and unique declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compaction_HPP
+#define RAJA_compaction_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+inline namespace policy_by_value_interface
+{
+
+/*!
+******************************************************************************
+*
+* \brief  copy_if execution pattern, copies the elements of in for which
+*         pred is true to out keeping their relative order
+*
+* \param[in] p Execution policy
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container with room for the copied elements
+* \param[in] pred unary predicate selecting the elements to copy
+*
+* \return ValueEventProxy holding the number of elements copied
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename InContainer,
+          typename OutContainer,
+          typename Predicate>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        Res r,
+        InContainer&& in,
+        OutContainer&& out,
+        Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+
+  if (begin(in) == end(in)) {
+    return resources::ValueEventProxy<Res, size_t>(r, 0);
+  }
+  return impl::compaction::copy_if(r, std::forward<ExecPolicy>(p),
+                                   begin(in), end(in), begin(out), pred);
+}
+///
+template <typename ExecPolicy,
+          typename InContainer,
+          typename OutContainer,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<InContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, InContainer>>,
+                      type_traits::is_range<OutContainer>>
+copy_if(ExecPolicy&& p,
+        InContainer&& in,
+        OutContainer&& out,
+        Predicate pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern, reorders c so the elements for which
+*         pred is true precede the others
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate to partition by
+*
+* \return ValueEventProxy holding the number of elements for which pred is
+*         true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Predicate>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+partition(ExecPolicy&& p,
+          Res r,
+          Container&& c,
+          Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  if (begin(c) == end(c)) {
+    return resources::ValueEventProxy<Res, size_t>(r, 0);
+  }
+  return impl::compaction::partition(r, std::forward<ExecPolicy>(p),
+                                     begin(c), end(c), pred);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+partition(ExecPolicy&& p,
+          Container&& c,
+          Predicate pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern, reorders c so the elements
+*         for which pred is true precede the others keeping the relative
+*         order of both
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] pred unary predicate to partition by
+*
+* \return ValueEventProxy holding the number of elements for which pred is
+*         true
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename Predicate>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+stable_partition(ExecPolicy&& p,
+                 Res r,
+                 Container&& c,
+                 Predicate pred)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  if (begin(c) == end(c)) {
+    return resources::ValueEventProxy<Res, size_t>(r, 0);
+  }
+  return impl::compaction::stable_partition(r, std::forward<ExecPolicy>(p),
+                                            begin(c), end(c), pred);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename Predicate,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+stable_partition(ExecPolicy&& p,
+                 Container&& c,
+                 Predicate pred)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_partition(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern, removes all but the first element of
+*         each run of consecutive elements of c that compare equal
+*
+* \param[in] p Execution policy
+* \param[in,out] c Random-Access Container
+* \param[in] eq binary predicate comparing an element to the one before it
+*
+* \return ValueEventProxy holding the number of elements kept, the kept
+*         elements are at the front of c
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Container,
+          typename BinaryPredicate = operators::equal_to<RAJA::detail::ContainerVal<Container>>>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<Container>>
+unique(ExecPolicy&& p,
+       Res r,
+       Container&& c,
+       BinaryPredicate eq = BinaryPredicate{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<BinaryPredicate, bool, T, T>::value,
+                "BinaryPredicate must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  if (begin(c) == end(c)) {
+    return resources::ValueEventProxy<Res, size_t>(r, 0);
+  }
+  return impl::compaction::unique(r, std::forward<ExecPolicy>(p),
+                                  begin(c), end(c), eq);
+}
+///
+template <typename ExecPolicy,
+          typename Container,
+          typename BinaryPredicate = operators::equal_to<RAJA::detail::ContainerVal<Container>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<Container>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, Container>>>
+unique(ExecPolicy&& p,
+       Container&& c,
+       BinaryPredicate eq = BinaryPredicate{})
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      eq);
+}
+
+}  // end inline namespace policy_by_value_interface
+
+// =============================================================================
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * copy_if
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+copy_if(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::copy_if(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+copy_if(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::copy_if(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * partition
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+partition(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+partition(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * stable_partition
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+stable_partition(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::stable_partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+stable_partition(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::stable_partition(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * unique
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+unique(Args &&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::unique(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+unique(Res r, Args &&... args)
+{
+  return ::RAJA::policy_by_value_interface::unique(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif
@@ -63,6 +63,27 @@ DiffType firstIndex(DiffType n, CountType num_threads, CountType thread_id)
   return (static_cast<size_t>(n) * thread_id) / num_threads;
 }
 
+/*!
+    \brief Executor that runs the chunks of a chunked algorithm in order,
+           used by the sequential back-ends
+*/
+struct SequentialChunkExecutor
+{
+  template <typename diff_type>
+  int num_chunks(diff_type) const
+  {
+    return 1;
+  }
+
+  template <typename Body>
+  RAJA_INLINE void operator()(int num_chunks, Body body) const
+  {
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      body(chunk);
+    }
+  }
+};
+
 }  // end namespace detail
 
 
@@ -77,6 +77,8 @@
 
 #include "RAJA/pattern/detail/forall.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/pattern/params/kernel_name.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
@@ -132,6 +134,30 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/// Run iterations [offset, offset + length) of a segment that starts at
+/// iteration icount of its index set
+struct CallForallPiece {
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&,
+                                                          Index_type icount,
+                                                          Index_type offset,
+                                                          Index_type length,
+                                                          ExecPol,
+                                                          Body,
+                                                          Res) const;
+};
+
+struct CallForallIcountPiece {
+  template <typename T, typename ExecPol, typename Body, typename Res>
+  RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&,
+                                                          Index_type icount,
+                                                          Index_type offset,
+                                                          Index_type length,
+                                                          ExecPol,
+                                                          Body,
+                                                          Res) const;
+};
 }  // namespace detail
 
 /*!
@@ -166,6 +192,61 @@ forall(Res r, ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
                      std::forward<LoopBody>(loop_body));
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and
+ *        forall parameters
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container,
+          typename LoopBody, typename... Params>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(Res r,
+       ExecutionPolicy&& p,
+       Container&& c,
+       LoopBody&& loop_body,
+       expt::ForallParamPack<Params...>& params)
+{
+  RAJA_FORCEINLINE_RECURSIVE
+  return forall_impl(r,
+                     std::forward<ExecutionPolicy>(p),
+                     std::forward<Container>(c),
+                     std::forward<LoopBody>(loop_body),
+                     params);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and
+ *        an empty set of forall parameters
+ *
+ ******************************************************************************
+ */
+template <typename Res, typename ExecutionPolicy, typename Container,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    RAJA::resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(Res r,
+       ExecutionPolicy&& p,
+       Container&& c,
+       LoopBody&& loop_body,
+       expt::ForallParamPack<>&)
+{
+  RAJA_FORCEINLINE_RECURSIVE
+  return forall_impl(r,
+                     std::forward<ExecutionPolicy>(p),
+                     std::forward<Container>(c),
+                     std::forward<LoopBody>(loop_body));
+}
+
 
 /*!
  ******************************************************************************
@@ -211,11 +292,13 @@ template <typename Res,
           typename SegmentExecPolicy,
           typename... SegmentTypes,
           typename LoopBody>
-RAJA_INLINE resources::EventProxy<Res> forall_Icount(Res r,
-                                                ExecPolicy<SegmentIterPolicy,
-                                                SegmentExecPolicy>,
-                                                const TypedIndexSet<SegmentTypes...>& iset,
-                                                LoopBody loop_body)
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_flatten_segit<SegmentIterPolicy>>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const TypedIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
 {
   // no need for icount variant here
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
@@ -234,11 +317,13 @@ template <typename Res,
           typename SegmentExecPolicy,
           typename LoopBody,
           typename... SegmentTypes>
-RAJA_INLINE resources::EventProxy<Res> forall(Res r,
-                                         ExecPolicy<SegmentIterPolicy,
-                                         SegmentExecPolicy>,
-                                         const TypedIndexSet<SegmentTypes...>& iset,
-                                         LoopBody loop_body)
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_flatten_segit<SegmentIterPolicy>>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
 {
   auto segIterRes = resources::get_resource<SegmentIterPolicy>::type::get_default();
   wrap::forall(segIterRes, SegmentIterPolicy(), iset, [=, &r](int segID) {
@@ -247,6 +332,57 @@ RAJA_INLINE resources::EventProxy<Res> forall(Res r,
   return RAJA::resources::EventProxy<Res>(r);
 }
 
+/*!
+******************************************************************************
+*
+* \brief Execute index set iterations with a flattening segment iteration
+*        policy, which splits the iterations of all segments across threads
+*        and runs each piece of a segment with the segment execution policy.
+*
+******************************************************************************
+*/
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename... SegmentTypes,
+          typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_flatten_segit<SegmentIterPolicy>>
+forall_Icount(Res r,
+              ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+              const TypedIndexSet<SegmentTypes...>& iset,
+              LoopBody loop_body)
+{
+  return forall_impl(r,
+                     SegmentIterPolicy(),
+                     SegmentExecPolicy(),
+                     iset,
+                     detail::CallForallIcountPiece{},
+                     loop_body);
+}
+
+template <typename Res,
+          typename SegmentIterPolicy,
+          typename SegmentExecPolicy,
+          typename LoopBody,
+          typename... SegmentTypes>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_flatten_segit<SegmentIterPolicy>>
+forall(Res r,
+       ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
+       const TypedIndexSet<SegmentTypes...>& iset,
+       LoopBody loop_body)
+{
+  return forall_impl(r,
+                     SegmentIterPolicy(),
+                     SegmentExecPolicy(),
+                     iset,
+                     detail::CallForallPiece{},
+                     loop_body);
+}
+
 }  // end namespace wrap
 
 
@@ -281,7 +417,8 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      static_cast<Index_type>(c.getLength()))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -331,7 +468,8 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      static_cast<Index_type>(c.getLength()))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -416,7 +554,8 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::detail::num_iterations(c))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -478,7 +617,8 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::detail::num_iterations(c))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -514,6 +654,169 @@ forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
       std::forward<LoopBody>(loop_body));
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and
+ *        forall parameters, such as RAJA::expt::Reduce, given between the
+ *        container and the loop body
+ *
+ * The loop body takes a reference to the value of each parameter after the
+ * index. Each thread works on private values that are combined once per
+ * thread when the loop ends.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Res, typename Container,
+          typename Param0, typename... ParamsAndBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_resource<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::is_forall_param<Param0>>
+forall(ExecutionPolicy&& p,
+       Res r,
+       Container&& c,
+       Param0&& param0,
+       ParamsAndBody&&... params_and_body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+  static_assert(sizeof...(ParamsAndBody) >= 1,
+                "forall parameters must be followed by a loop body");
+
+  auto params = expt::make_forall_param_pack(
+      std::forward<Param0>(param0),
+      std::forward<ParamsAndBody>(params_and_body)...);
+  auto&& loop_body = expt::get_lambda(
+      std::forward<Param0>(param0),
+      std::forward<ParamsAndBody>(params_and_body)...);
+
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::detail::num_iterations(c))};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = wrap::forall(
+      r,
+      std::forward<ExecutionPolicy>(p),
+      std::forward<Container>(c),
+      std::move(body),
+      params);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+template <typename ExecutionPolicy, typename Container,
+          typename Param0, typename... ParamsAndBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>,
+    expt::is_forall_param<Param0>>
+forall(ExecutionPolicy&& p,
+       Container&& c,
+       Param0&& param0,
+       ParamsAndBody&&... params_and_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      std::forward<Param0>(param0),
+      std::forward<ParamsAndBody>(params_and_body)...);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and a
+ *        kernel name, given between the container and the forall parameters
+ *        or loop body
+ *
+ * The name is passed to the plugins in RAJA::util::PluginContext and is not
+ * seen by the loop body.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Res, typename Container,
+          typename... ParamsAndBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_resource<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p,
+       Res r,
+       Container&& c,
+       expt::KernelName name,
+       ParamsAndBody&&... params_and_body)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+  static_assert(sizeof...(ParamsAndBody) >= 1,
+                "a kernel name must be followed by a loop body");
+
+  auto params = expt::make_forall_param_pack(
+      std::forward<ParamsAndBody>(params_and_body)...);
+  auto&& loop_body = expt::get_lambda(
+      std::forward<ParamsAndBody>(params_and_body)...);
+
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      util::detail::num_iterations(c), name.name)};
+  util::callPreCapturePlugins(context);
+
+  using RAJA::util::trigger_updates_before;
+  auto body = trigger_updates_before(loop_body);
+
+  util::callPostCapturePlugins(context);
+
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = wrap::forall(
+      r,
+      std::forward<ExecutionPolicy>(p),
+      std::forward<Container>(c),
+      std::move(body),
+      params);
+
+  util::callPostLaunchPlugins(context);
+  return e;
+}
+template <typename ExecutionPolicy, typename Container,
+          typename... ParamsAndBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p,
+       Container&& c,
+       expt::KernelName name,
+       ParamsAndBody&&... params_and_body)
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::forall(
+      std::forward<ExecutionPolicy>(p),
+      r,
+      std::forward<Container>(c),
+      name,
+      std::forward<ParamsAndBody>(params_and_body)...);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -587,6 +890,34 @@ RAJA_INLINE camp::resources::EventProxy<Res> CallForallIcount::operator()(T cons
   return wrap::forall_Icount(r, ExecutionPolicy(), segment, start, body);
 }
 
+template <typename T, typename ExecutionPolicy, typename LoopBody, typename Res>
+RAJA_INLINE camp::resources::EventProxy<Res> CallForallPiece::operator()(
+    T const& segment,
+    Index_type,
+    Index_type offset,
+    Index_type length,
+    ExecutionPolicy,
+    LoopBody body,
+    Res r) const
+{
+  return CallForall{}(
+      make_span(segment.begin() + offset, length), ExecutionPolicy(), body, r);
+}
+
+template <typename T, typename ExecutionPolicy, typename LoopBody, typename Res>
+RAJA_INLINE camp::resources::EventProxy<Res> CallForallIcountPiece::operator()(
+    T const& segment,
+    Index_type icount,
+    Index_type offset,
+    Index_type length,
+    ExecutionPolicy,
+    LoopBody body,
+    Res r) const
+{
+  return CallForallIcount(static_cast<int>(icount + offset))(
+      make_span(segment.begin() + offset, length), ExecutionPolicy(), body, r);
+}
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -0,0 +1,301 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing forall, kernel, scan, and sort overloads
+ *          that submit work to a RAJA::resources::HostAsync queue.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_host_async_HPP
+#define RAJA_pattern_host_async_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/HostAsync.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/pattern/sort.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * \brief Queued call holding copies of its arguments, which it passes to
+ *        call as lvalues when run.
+ */
+template <typename Call, typename... Args>
+struct HostAsyncTask {
+  Call call;
+  camp::tuple<Args...> args;
+
+  template <camp::idx_t... Is>
+  void apply(camp::idx_seq<Is...>)
+  {
+    call(camp::get<Is>(args)...);
+  }
+
+  void operator()() { apply(camp::make_idx_seq_t<sizeof...(Args)>{}); }
+};
+
+/*!
+ * \brief Queue call(args...) on r, copying args as std::thread does.
+ *
+ *        Pointers and views are copied, not the data they refer to, so the
+ *        data must stay valid until the returned event is complete.
+ */
+template <typename ExecPolicy, typename Call, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> host_async_submit(
+    resources::HostAsync r,
+    Call call,
+    Args&&... args)
+{
+  static_assert(std::is_same<resources::resource_from_pol_t<ExecPolicy>,
+                             resources::Host>::value,
+                "RAJA::resources::HostAsync requires a host execution policy");
+
+  r.enqueue(HostAsyncTask<Call, camp::decay<Args>...>{
+      call, camp::tuple<camp::decay<Args>...>(std::forward<Args>(args)...)});
+  return resources::EventProxy<resources::HostAsync>(r);
+}
+
+}  // namespace internal
+
+/*!
+ * \brief Submit a forall to a HostAsync resource. The loop runs with
+ *        ExecutionPolicy on the worker thread of r.
+ *
+ * \return EventProxy for the work submitted to r
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> forall(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecutionPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::forall<ExecutionPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> forall_Icount(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecutionPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::forall_Icount<ExecutionPolicy>(resources::Host::get_default(),
+                                             a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Submit a kernel to a HostAsync resource.
+ *
+ *        Reduction objects in the bodies or params are copied into the
+ *        queued kernel, so read them after the returned event is complete.
+ */
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> kernel_param_resource(
+    SegmentTuple&& segments,
+    ParamTuple&& params,
+    resources::HostAsync resource,
+    Bodies&&... bodies)
+{
+  return internal::host_async_submit<PolicyType>(
+      resource,
+      [](camp::decay<SegmentTuple>& s,
+         camp::decay<ParamTuple>& p,
+         camp::decay<Bodies>&... b) {
+        RAJA::kernel_param_resource<PolicyType>(
+            s, p, resources::Host::get_default(), b...);
+      },
+      std::forward<SegmentTuple>(segments),
+      std::forward<ParamTuple>(params),
+      std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> kernel_resource(
+    SegmentTuple&& segments,
+    resources::HostAsync resource,
+    Bodies&&... bodies)
+{
+  return RAJA::kernel_param_resource<PolicyType>(
+      std::forward<SegmentTuple>(segments),
+      RAJA::make_tuple(),
+      resource,
+      std::forward<Bodies>(bodies)...);
+}
+
+/*!
+ * \brief Scans and sorts submitted to a HostAsync resource.
+ *
+ *        Containers are copied into the queued call, so pass views of the
+ *        data such as RAJA::make_span rather than owning containers.
+ */
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> inclusive_scan(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::inclusive_scan<ExecPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> exclusive_scan(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::exclusive_scan<ExecPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> inclusive_scan_inplace(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::inclusive_scan_inplace<ExecPolicy>(resources::Host::get_default(),
+                                                 a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> exclusive_scan_inplace(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::exclusive_scan_inplace<ExecPolicy>(resources::Host::get_default(),
+                                                 a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync>
+inclusive_segmented_scan(resources::HostAsync r, Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::inclusive_segmented_scan<ExecPolicy>(
+            resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync>
+exclusive_segmented_scan(resources::HostAsync r, Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::exclusive_segmented_scan<ExecPolicy>(
+            resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> sort(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::sort<ExecPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> stable_sort(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::stable_sort<ExecPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> sort_pairs(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::sort_pairs<ExecPolicy>(resources::Host::get_default(), a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> stable_sort_pairs(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  return internal::host_async_submit<ExecPolicy>(
+      r,
+      [](camp::decay<Args>&... a) {
+        RAJA::stable_sort_pairs<ExecPolicy>(resources::Host::get_default(),
+                                            a...);
+      },
+      std::forward<Args>(args)...);
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
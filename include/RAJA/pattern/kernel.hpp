@@ -30,6 +30,8 @@
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/foldl.hpp"
+
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -82,6 +84,23 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE Index_type num_iterations_impl(Tuple const &t, camp::idx_seq<I...>)
+{
+  return RAJA::product<Index_type>(
+      Index_type(1),
+      util::detail::num_iterations(camp::get<I>(t))...);
+}
+
+/// Number of iterations of the kernel, the product of the segment lengths
+template <class Tuple>
+RAJA_INLINE Index_type num_iterations(Tuple const &t)
+{
+  return num_iterations_impl(
+      t,
+      camp::make_idx_seq_t<camp::tuple_size<camp::decay<Tuple>>::value>{});
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -106,7 +125,8 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{util::make_context<PolicyType>(
+      internal::num_iterations(segments))};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -208,6 +228,7 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/TiledHyperplane.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
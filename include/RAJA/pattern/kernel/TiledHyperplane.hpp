@@ -0,0 +1,383 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for tiled hyperplane (wavefront) pattern executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_TiledHyperplane_HPP
+#define RAJA_pattern_kernel_TiledHyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+///! tag for tiles with a fixed size per argument of a TiledHyperplane
+template <camp::idx_t... TileSizes>
+struct tile_fixed_sizes {
+};
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that performs a tiled hyperplane (wavefront)
+ * iteration over multiple indices.
+ *
+ * The iteration space of the arguments in ArgList is split into tiles of
+ * TilePolicy, which is either tile_fixed<N> for N x N x ... tiles or
+ * tile_fixed_sizes<N0, N1, ...> for one size per argument. Tile (t0, t1, ...)
+ * lies on tile hyperplane H = t0 + t1 + ... and the tile hyperplanes are
+ * executed in order, so every iterate runs after the iterates that are one
+ * less in any of the arguments, as with statement::Hyperplane.
+ *
+ * The iterates of a tile are executed in lexicographic order of ArgList, so
+ * the argument with stride-one data access should be last. The tiles of one
+ * tile hyperplane are independent and are executed with TileExecPolicy:
+ *
+ *  for(H = 0; H < num_tile_hyperplanes; ++ H){
+ *
+ *    RAJA::forall<TileExecPolicy>(tiles on H, [=](tile){
+ *
+ *      for(i0 in tile)
+ *        for(i1 in tile)
+ *          ...
+ *            loop_body(i0, i1, ...);
+ *
+ *    });
+ *
+ *  }
+ *
+ * With RAJA::omp_hyperplane_dataflow_exec the tile hyperplanes are not
+ * separated by barriers. Instead each tile waits only for the tiles it
+ * depends on to finish.
+ */
+template <typename ArgList,
+          typename TilePolicy,
+          typename TileExecPolicy,
+          typename... EnclosedStmts>
+struct TiledHyperplane
+    : public internal::Statement<TileExecPolicy, EnclosedStmts...> {
+  using tile_policy_t = TilePolicy;
+  using exec_policy_t = TileExecPolicy;
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+template <typename TilePolicy>
+struct TiledHyperplaneTileSizes;
+
+template <camp::idx_t TileSize>
+struct TiledHyperplaneTileSizes<tile_fixed<TileSize>> {
+  static constexpr bool valid_for(camp::idx_t) { return true; }
+
+  static void get(camp::idx_t *sizes, camp::idx_t num_args)
+  {
+    for (camp::idx_t d = 0; d < num_args; ++d) {
+      sizes[d] = TileSize;
+    }
+  }
+};
+
+template <camp::idx_t... TileSizes>
+struct TiledHyperplaneTileSizes<tile_fixed_sizes<TileSizes...>> {
+  static constexpr bool valid_for(camp::idx_t num_args)
+  {
+    return camp::idx_t(sizeof...(TileSizes)) == num_args;
+  }
+
+  static void get(camp::idx_t *sizes, camp::idx_t)
+  {
+    const camp::idx_t values[] = {TileSizes...};
+    for (camp::idx_t d = 0; d < camp::idx_t(sizeof...(TileSizes)); ++d) {
+      sizes[d] = values[d];
+    }
+  }
+};
+
+
+/*!
+ * Order in which the tiles of a TiledHyperplane are executed.
+ *
+ * Tiles are numbered lexicographically, with the last argument fastest, and
+ * tiles lists them by tile hyperplane so that the tiles of hyperplane H are
+ * tiles[plane_begin[H]] ... tiles[plane_begin[H+1]-1].
+ */
+template <camp::idx_t NumArgs>
+struct TiledHyperplaneSchedule {
+  camp::idx_t length[NumArgs];
+  camp::idx_t tile_size[NumArgs];
+  camp::idx_t num_tiles[NumArgs];
+
+  std::vector<camp::idx_t> tiles;
+  std::vector<camp::idx_t> plane_begin;
+
+  TiledHyperplaneSchedule(camp::idx_t const *lengths,
+                          camp::idx_t const *tile_sizes)
+  {
+    camp::idx_t total = 1;
+    camp::idx_t num_planes = 1;
+    for (camp::idx_t d = 0; d < NumArgs; ++d) {
+      length[d] = lengths[d] > 0 ? lengths[d] : 0;
+      tile_size[d] = tile_sizes[d];
+      num_tiles[d] = (length[d] + tile_size[d] - 1) / tile_size[d];
+      total *= num_tiles[d];
+      num_planes += num_tiles[d] - 1;
+    }
+    if (total == 0) {
+      plane_begin.assign(1, 0);
+      return;
+    }
+
+    // counting sort of the tiles by hyperplane, keeping the lexicographic
+    // order within each hyperplane
+    plane_begin.assign(num_planes + 1, 0);
+    for (camp::idx_t t = 0; t < total; ++t) {
+      ++plane_begin[get_plane(t) + 1];
+    }
+    for (camp::idx_t h = 0; h < num_planes; ++h) {
+      plane_begin[h + 1] += plane_begin[h];
+    }
+    tiles.resize(total);
+    std::vector<camp::idx_t> next(plane_begin.begin(), plane_begin.end() - 1);
+    for (camp::idx_t t = 0; t < total; ++t) {
+      tiles[next[get_plane(t)]++] = t;
+    }
+  }
+
+  camp::idx_t get_num_planes() const
+  {
+    return camp::idx_t(plane_begin.size()) - 1;
+  }
+
+  void get_coords(camp::idx_t tile, camp::idx_t *coords) const
+  {
+    for (camp::idx_t d = NumArgs - 1; d >= 0; --d) {
+      coords[d] = tile % num_tiles[d];
+      tile /= num_tiles[d];
+    }
+  }
+
+  camp::idx_t get_plane(camp::idx_t tile) const
+  {
+    camp::idx_t coords[NumArgs];
+    get_coords(tile, coords);
+    camp::idx_t h = 0;
+    for (camp::idx_t d = 0; d < NumArgs; ++d) {
+      h += coords[d];
+    }
+    return h;
+  }
+
+  void get_bounds(camp::idx_t tile,
+                  camp::idx_t *begin,
+                  camp::idx_t *end) const
+  {
+    get_coords(tile, begin);
+    for (camp::idx_t d = 0; d < NumArgs; ++d) {
+      begin[d] *= tile_size[d];
+      end[d] = begin[d] + tile_size[d] < length[d] ? begin[d] + tile_size[d]
+                                                   : length[d];
+    }
+  }
+};
+
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct TiledHyperplaneTypes {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Arg0, camp::idx_t... Args>
+struct TiledHyperplaneTypes<Types, Data, Arg0, Args...> {
+  using type = typename TiledHyperplaneTypes<
+      setSegmentTypeFromData<Types, Arg0, Data>,
+      Data,
+      Args...>::type;
+};
+
+
+/*!
+ * Loop nest over the iterates of one tile, in lexicographic order
+ */
+template <camp::idx_t... Args>
+struct TiledHyperplaneLoop;
+
+template <>
+struct TiledHyperplaneLoop<> {
+  template <typename Data, typename Wrapper>
+  static RAJA_INLINE void exec(Data &,
+                               camp::idx_t const *,
+                               camp::idx_t const *,
+                               Wrapper &wrapper)
+  {
+    wrapper.exec();
+  }
+};
+
+template <camp::idx_t Arg0, camp::idx_t... Args>
+struct TiledHyperplaneLoop<Arg0, Args...> {
+  template <typename Data, typename Wrapper>
+  static RAJA_INLINE void exec(Data &data,
+                               camp::idx_t const *begin,
+                               camp::idx_t const *end,
+                               Wrapper &wrapper)
+  {
+    using offset_t =
+        camp::tuple_element_t<Arg0, typename Data::offset_tuple_t>;
+    for (camp::idx_t i = begin[0]; i < end[0]; ++i) {
+      data.template assign_offset<Arg0>(static_cast<offset_t>(i));
+      TiledHyperplaneLoop<Args...>::exec(data, begin + 1, end + 1, wrapper);
+    }
+  }
+};
+
+
+template <typename T>
+struct TiledHyperplanePrivatizer {
+  using data_t = typename T::data_t;
+  using value_type = camp::decay<T>;
+  using reference_type = value_type &;
+
+  data_t privatized_data;
+  value_type privatized_wrapper;
+
+  RAJA_INLINE
+  TiledHyperplanePrivatizer(const T &o)
+      : privatized_data{o.data},
+        privatized_wrapper(privatized_data, o.schedule)
+  {
+  }
+
+  RAJA_INLINE
+  reference_type get_priv() { return privatized_wrapper; }
+};
+
+
+/*!
+ * Executes the tile at position k of the schedule
+ */
+template <typename ArgList,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct TiledHyperplaneWrapper;
+
+template <camp::idx_t... Args,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct TiledHyperplaneWrapper<ArgList<Args...>, Data, Types, EnclosedStmts...>
+    : public GenericWrapper<Data, Types, EnclosedStmts...> {
+
+  using Base = GenericWrapper<Data, Types, EnclosedStmts...>;
+  using schedule_t = TiledHyperplaneSchedule<sizeof...(Args)>;
+  using privatizer = TiledHyperplanePrivatizer<TiledHyperplaneWrapper>;
+
+  schedule_t const *schedule;
+
+  RAJA_INLINE
+  TiledHyperplaneWrapper(typename Base::data_t &d, schedule_t const *s)
+      : Base(d), schedule(s)
+  {
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType k)
+  {
+    camp::idx_t begin[sizeof...(Args)];
+    camp::idx_t end[sizeof...(Args)];
+    schedule->get_bounds(schedule->tiles[k], begin, end);
+    TiledHyperplaneLoop<Args...>::exec(Base::data, begin, end, *this);
+  }
+};
+
+
+/*!
+ * Builds the schedule of a TiledHyperplane from the segment lengths
+ */
+template <typename TilePolicy, camp::idx_t... Args, typename Data>
+RAJA_INLINE TiledHyperplaneSchedule<sizeof...(Args)>
+make_tiled_hyperplane_schedule(Data const &data)
+{
+  const camp::idx_t lengths[] = {
+      static_cast<camp::idx_t>(segment_length<Args>(data))...};
+  camp::idx_t tile_sizes[sizeof...(Args)];
+  TiledHyperplaneTileSizes<TilePolicy>::get(tile_sizes, sizeof...(Args));
+  return TiledHyperplaneSchedule<sizeof...(Args)>(lengths, tile_sizes);
+}
+
+
+template <camp::idx_t... Args,
+          typename TilePolicy,
+          typename TileExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::TiledHyperplane<ArgList<Args...>,
+                                                    TilePolicy,
+                                                    TileExecPolicy,
+                                                    EnclosedStmts...>,
+                         Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    static_assert(TiledHyperplaneTileSizes<TilePolicy>::valid_for(
+                      sizeof...(Args)),
+                  "TiledHyperplane needs one tile size per argument");
+
+    using data_t = camp::decay<Data>;
+
+    // Set the argument types for the tile loops
+    using NewTypes =
+        typename TiledHyperplaneTypes<Types, data_t, Args...>::type;
+
+    auto schedule = make_tiled_hyperplane_schedule<TilePolicy, Args...>(data);
+
+    TiledHyperplaneWrapper<ArgList<Args...>, data_t, NewTypes, EnclosedStmts...>
+        tile_wrapper(data, &schedule);
+
+    // Execute the tiles of each tile hyperplane in order
+    auto r = resources::get_resource<TileExecPolicy>::type::get_default();
+    for (camp::idx_t h = 0; h < schedule.get_num_planes(); ++h) {
+      forall_impl(r,
+                  TileExecPolicy{},
+                  TypedRangeSegment<camp::idx_t>(schedule.plane_begin[h],
+                                                 schedule.plane_begin[h + 1]),
+                  tile_wrapper);
+    }
+  }
+};
+
+
+}  // end namespace internal
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_TiledHyperplane_HPP */
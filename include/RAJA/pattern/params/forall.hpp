@@ -0,0 +1,217 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the parameter pack of the forall parameters
+ *          passed between the iteration space and the loop body, and the
+ *          operations the back-ends use on it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_PARAMS_FORALL_HPP
+#define RAJA_PATTERN_PARAMS_FORALL_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/params/reducer.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! True for the types that are passed to forall before the loop body
+template <typename T>
+struct is_forall_param
+    : std::is_base_of<ForallParamBase, camp::decay<T>> {
+};
+
+/*!
+ * \brief The forall parameters of a loop.
+ *
+ *        Back-ends give each thread a copy, initialized with init_params,
+ *        call the loop body through invoke_body, merge the copies with
+ *        combine_params and finish with resolve_params.
+ */
+template <typename... Params>
+struct ForallParamPack {
+  using params_type = camp::tuple<Params...>;
+
+  static constexpr size_t size = sizeof...(Params);
+
+  params_type param_tup;
+};
+
+namespace detail
+{
+
+template <typename Pack, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE void init_params(Pack& pack,
+                                              camp::idx_seq<Is...>)
+{
+  camp::sink((camp::get<Is>(pack.param_tup).init(), 0)...);
+}
+
+template <typename Pack, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE void combine_params(Pack& pack,
+                                                 const Pack& other,
+                                                 camp::idx_seq<Is...>)
+{
+  camp::sink((camp::get<Is>(pack.param_tup)
+                  .combine(camp::get<Is>(other.param_tup)),
+              0)...);
+}
+
+template <typename Pack, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE void resolve_params(Pack& pack,
+                                                 camp::idx_seq<Is...>)
+{
+  camp::sink((camp::get<Is>(pack.param_tup).resolve(), 0)...);
+}
+
+template <typename Pack, typename Body, typename Index, camp::idx_t... Is>
+RAJA_HOST_DEVICE RAJA_INLINE void invoke_body(Pack& pack,
+                                              Body&& body,
+                                              Index&& i,
+                                              camp::idx_seq<Is...>)
+{
+  body(std::forward<Index>(i), camp::get<Is>(pack.param_tup).get_ref()...);
+}
+
+template <typename Tuple, size_t... Is>
+RAJA_INLINE ForallParamPack<
+    camp::decay<typename std::tuple_element<Is, Tuple>::type>...>
+make_forall_param_pack(Tuple&& args, std::index_sequence<Is...>)
+{
+  using pack_type = ForallParamPack<
+      camp::decay<typename std::tuple_element<Is, Tuple>::type>...>;
+  return pack_type{typename pack_type::params_type{std::get<Is>(args)...}};
+}
+
+}  // namespace detail
+
+//! Reset each parameter of the pack for a thread that has not run yet
+template <typename... Params>
+RAJA_HOST_DEVICE RAJA_INLINE void init_params(ForallParamPack<Params...>& pack)
+{
+  detail::init_params(pack, camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+//! Combine the parameters of another copy of the pack into this one
+template <typename... Params>
+RAJA_HOST_DEVICE RAJA_INLINE void combine_params(
+    ForallParamPack<Params...>& pack,
+    const ForallParamPack<Params...>& other)
+{
+  detail::combine_params(pack,
+                         other,
+                         camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+//! Write the results of the parameters back to the user's variables
+template <typename... Params>
+RAJA_HOST_DEVICE RAJA_INLINE void resolve_params(
+    ForallParamPack<Params...>& pack)
+{
+  detail::resolve_params(pack, camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+//! Call body(i, params...) with references to the values of the pack
+template <typename... Params, typename Body, typename Index>
+RAJA_HOST_DEVICE RAJA_INLINE void invoke_body(ForallParamPack<Params...>& pack,
+                                              Body&& body,
+                                              Index&& i)
+{
+  detail::invoke_body(pack,
+                      std::forward<Body>(body),
+                      std::forward<Index>(i),
+                      camp::make_idx_seq_t<sizeof...(Params)>{});
+}
+
+//! Pack of the forall arguments before the last one, the loop body
+template <typename... Args>
+RAJA_INLINE auto make_forall_param_pack(Args&&... args)
+    -> decltype(detail::make_forall_param_pack(
+        std::forward_as_tuple(std::forward<Args>(args)...),
+        std::make_index_sequence<sizeof...(Args) - 1>{}))
+{
+  return detail::make_forall_param_pack(
+      std::forward_as_tuple(std::forward<Args>(args)...),
+      std::make_index_sequence<sizeof...(Args) - 1>{});
+}
+
+//! The last forall argument, the loop body
+template <typename... Args>
+RAJA_INLINE auto get_lambda(Args&&... args)
+    -> decltype(std::get<sizeof...(Args) - 1>(
+        std::forward_as_tuple(std::forward<Args>(args)...)))
+{
+  return std::get<sizeof...(Args) - 1>(
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+/*!
+ * \brief Per thread copies of a forall parameter pack for a parallel region
+ *        of at most max_threads threads.
+ *
+ *        Each thread runs its iterations on a private copy from get_priv()
+ *        and stores it once with store(). finalize() combines the stored
+ *        copies in thread order, so for a static schedule the result does
+ *        not depend on timing, and resolves the pack.
+ */
+template <typename Pack>
+class ThreadParams
+{
+public:
+  ThreadParams(Pack& pack, int max_threads) : m_pack(pack), m_identity(pack)
+  {
+    init_params(m_identity);
+    m_thread.assign(max_threads, m_identity);
+  }
+
+  //! Copy of the pack for a thread to run its iterations on
+  Pack get_priv() const { return m_identity; }
+
+  //! Keep the private copy of thread tid when it has finished
+  void store(int tid, const Pack& priv) { m_thread[tid] = priv; }
+
+  //! Combine the copies of all threads and write the results back
+  void finalize()
+  {
+    for (const Pack& priv : m_thread) {
+      combine_params(m_pack, priv);
+    }
+    resolve_params(m_pack);
+  }
+
+private:
+  Pack& m_pack;
+  Pack m_identity;
+  std::vector<Pack> m_thread;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
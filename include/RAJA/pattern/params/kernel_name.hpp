@@ -0,0 +1,49 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA::expt::KernelName, a name for a forall
+ *          launch that is passed to the plugins.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_PARAMS_KERNEL_NAME_HPP
+#define RAJA_PATTERN_PARAMS_KERNEL_NAME_HPP
+
+#include "RAJA/config.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief Name of a forall launch, given right after the iteration space.
+ *
+ * The name is not passed to the loop body, it is reported to the plugins
+ * as RAJA::util::PluginContext::kernel_name. The string must outlive the
+ * plugins' use of it, a string literal is the usual choice.
+ *
+ *     RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+ *                                  RAJA::expt::KernelName("daxpy"),
+ *                                  [=](int i) { y[i] += a * x[i]; });
+ */
+struct KernelName {
+  explicit KernelName(const char* kernel_name) : name(kernel_name) {}
+
+  const char* name;
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif  //  RAJA_PATTERN_PARAMS_KERNEL_NAME_HPP
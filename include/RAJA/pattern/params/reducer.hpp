@@ -0,0 +1,105 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing the RAJA::expt::Reduce forall parameter,
+ *          a reduction passed to the loop body as a reference to a thread
+ *          private value.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_PARAMS_REDUCER_HPP
+#define RAJA_PATTERN_PARAMS_REDUCER_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! Base class of the types that are passed to forall before the loop body
+struct ForallParamBase {
+};
+
+namespace detail
+{
+
+/*!
+ * \brief Reduction of values of type T with operator Op into *target.
+ *
+ *        Each thread running the loop gets its own copy, starting at the
+ *        identity of Op, and the loop body gets a reference to its value.
+ *        The copies are combined with each other and finally with the
+ *        value of *target.
+ */
+template <typename Op, typename T>
+struct Reducer : public ForallParamBase {
+  using op = Op;
+  using value_type = T;
+
+  Reducer() = default;
+
+  RAJA_HOST_DEVICE explicit Reducer(value_type* target_in)
+      : target(target_in), val(op::identity())
+  {
+  }
+
+  //! reset to the identity, before a thread runs its iterations
+  RAJA_HOST_DEVICE void init() { val = op::identity(); }
+
+  //! combine the value of another copy into this one
+  RAJA_HOST_DEVICE void combine(const Reducer& other)
+  {
+    val = op{}(val, other.val);
+  }
+
+  //! combine the value into the target, after all copies are combined
+  RAJA_HOST_DEVICE void resolve() { *target = op{}(*target, val); }
+
+  //! the argument passed to the loop body
+  RAJA_HOST_DEVICE value_type& get_ref() { return val; }
+
+  value_type* target = nullptr;
+  value_type val = op::identity();
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Reduction forall parameter with operator Op into *target.
+ *
+ * For example,
+ *
+ *   double sum = 0.0;
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+ *     RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+ *     [=](int i, double& s) { s += x[i]; });
+ *
+ * adds the sum of x to sum. The loop body gets one argument per forall
+ * parameter after the index, in the order of the parameters.
+ */
+template <template <typename, typename, typename> class Op, typename T>
+RAJA_HOST_DEVICE detail::Reducer<Op<T, T, T>, T> Reduce(T* target)
+{
+  return detail::Reducer<Op<T, T, T>, T>(target);
+}
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
@@ -27,10 +27,78 @@
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/segmented_scan.hpp"
 
 namespace RAJA
 {
 
+/*!
+******************************************************************************
+*
+* \brief  describe the segments of a segmented scan with head flags, a
+*         nonzero flag starts a new segment
+*
+* \param[in] flags Random-Access Container of flags, one per element
+*
+******************************************************************************
+*/
+template <typename Container>
+RAJA_INLINE detail::SegmentFlags<detail::ContainerIter<Container>>
+segment_flags(Container&& flags)
+{
+  using std::begin;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return {begin(flags)};
+}
+
+/*!
+******************************************************************************
+*
+* \brief  describe the segments of a segmented scan with keys, each run of
+*         equal keys is a segment
+*
+* \param[in] keys Random-Access Container of keys, one per element
+*
+******************************************************************************
+*/
+template <typename Container>
+RAJA_INLINE detail::SegmentKeys<detail::ContainerIter<Container>>
+segment_keys(Container&& keys)
+{
+  using std::begin;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return {begin(keys)};
+}
+
+/*!
+******************************************************************************
+*
+* \brief  describe the segments of a segmented scan with keys, each run of
+*         equal keys is a segment; reduce_by_key writes the key of each
+*         segment to keys_out
+*
+* \param[in] keys Random-Access Container of keys, one per element
+* \param[out] keys_out Random-Access Container with room for one key per
+*            segment
+*
+******************************************************************************
+*/
+template <typename Container, typename OutContainer>
+RAJA_INLINE detail::SegmentKeys<detail::ContainerIter<Container>,
+                                detail::ContainerIter<OutContainer>>
+segment_keys(Container&& keys, OutContainer&& keys_out)
+{
+  using std::begin;
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  return {begin(keys), begin(keys_out)};
+}
+
 inline namespace policy_by_value_interface
 {
 
@@ -320,6 +388,260 @@ exclusive_scan(ExecPolicy&& p,
       value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern, the scan restarts at
+*         the first element of each segment
+*
+* \param[in] p Execution policy
+* \param[in] segments Segments from segment_flags or segment_keys
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container
+* \param[in] binop binary function to apply for scan
+*
+* \note{out may be the same container as in}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         Segments&& segments,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         segments,
+                                         begin(in), end(in), begin(out), binop);
+}
+///
+template <typename ExecPolicy,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         Segments&& segments,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Segments>(segments),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern, the scan restarts
+*         from value at the first element of each segment
+*
+* \param[in] p Execution policy
+* \param[in] segments Segments from segment_flags or segment_keys
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container
+* \param[in] binop binary function to apply for scan
+* \param[in] value first output of each segment
+*
+* \note{out may be the same container as in}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         Segments&& segments,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         segments,
+                                         begin(in), end(in), begin(out), binop,
+                                         value);
+}
+///
+template <typename ExecPolicy,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         Segments&& segments,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Segments>(segments),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce by key execution pattern, reduces each segment of in into
+*         consecutive elements of out
+*
+* \param[in] p Execution policy
+* \param[in] segments Segments from segment_flags or segment_keys
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container with room for one value per
+*            segment
+* \param[in] binop binary function to apply for reduction
+*
+* \return ValueEventProxy holding the number of segments
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+reduce_by_key(ExecPolicy&& p,
+              Res r,
+              Segments&& segments,
+              InContainer&& in,
+              OutContainer&& out,
+              Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::ValueEventProxy<Res, size_t>(r, 0);
+  }
+  return impl::scan::reduce_by_key(r, std::forward<ExecPolicy>(p),
+                                   segments,
+                                   begin(in), end(in), begin(out), binop);
+}
+///
+template <typename ExecPolicy,
+          typename Segments,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      RAJA::detail::is_segments<Segments>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+reduce_by_key(ExecPolicy&& p,
+              Segments&& segments,
+              InContainer&& in,
+              OutContainer&& out,
+              Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<Segments>(segments),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -439,6 +761,93 @@ inclusive_scan_inplace(Res r, Args&&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * reduce_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+reduce_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::reduce_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<Res, size_t>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+reduce_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::reduce_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
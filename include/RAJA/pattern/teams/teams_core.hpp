@@ -19,6 +19,12 @@
 #define RAJA_pattern_teams_core_HPP
 
 #include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
@@ -128,11 +134,26 @@ struct Lanes {
   constexpr Lanes(int i) : value(i) {}
 };
 
+//! Bytes of team shared memory of a Grid, see LaunchContext::getSharedMemory
+struct SharedMem {
+  size_t value;
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr SharedMem() : value(0) {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  explicit constexpr SharedMem(size_t bytes) : value(bytes) {}
+};
+
 struct Grid {
 public:
   Teams teams;
   Threads threads;
   Lanes lanes;
+  //! Bytes of team shared memory handed out by LaunchContext::getSharedMemory
+  size_t shared_mem_size{0};
   const char *kernel_name{nullptr};
 
   RAJA_INLINE
@@ -141,6 +162,15 @@ public:
   Grid(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  Grid(Teams in_teams,
+       Threads in_threads,
+       SharedMem in_shared_mem,
+       const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      shared_mem_size(in_shared_mem.value),
+      kernel_name(in_kernel_name){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -156,20 +186,145 @@ private:
 };
 
 
+/*!
+ * Barrier for the threads of one team of a host teams launch.
+ */
+class HostTeamBarrier
+{
+public:
+  //! Wait until all team_size threads of the team have arrived
+  void wait(int team_size)
+  {
+    if (team_size <= 1) {
+      return;
+    }
+    const int generation = m_generation.load(std::memory_order_acquire);
+    if (m_count.fetch_add(1, std::memory_order_acq_rel) == team_size - 1) {
+      m_count.store(0, std::memory_order_relaxed);
+      m_generation.fetch_add(1, std::memory_order_release);
+    } else {
+      while (m_generation.load(std::memory_order_acquire) == generation) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  std::atomic<int> m_count{0};
+  std::atomic<int> m_generation{0};
+};
+
+/*!
+ * Place of a thread in a host teams launch, such as omp_team_launch_t.
+ *
+ * The depths count the team and thread loops the thread is inside of, so
+ * only the outermost team loop is distributed over the teams and only the
+ * outermost thread loop over the threads of a team.
+ */
+struct HostTeam {
+  int id{0};
+  int num_teams{1};
+  int rank{0};
+  int size{1};
+  int team_loop_depth{0};
+  int thread_loop_depth{0};
+  HostTeamBarrier *barrier{nullptr};
+};
+
+/*!
+ * Team shared memory of a launch on the host, one block of bytes per team.
+ */
+class HostTeamSharedMem
+{
+public:
+  HostTeamSharedMem(size_t bytes, int num_teams)
+      : m_stride((bytes + s_align - 1) / s_align * s_align)
+  {
+    if (m_stride > 0 && num_teams > 0) {
+      m_data = allocate_aligned_type<char>(s_align, m_stride * num_teams);
+      if (m_data == nullptr) {
+        RAJA_ABORT_OR_THROW("HostTeamSharedMem memory allocation failed");
+      }
+    }
+  }
+
+  HostTeamSharedMem(HostTeamSharedMem const &) = delete;
+  HostTeamSharedMem &operator=(HostTeamSharedMem const &) = delete;
+
+  ~HostTeamSharedMem()
+  {
+    if (m_data != nullptr) {
+      free_aligned(m_data);
+    }
+  }
+
+  //! Team shared memory of team, or nullptr when the launch has none
+  char *get(int team) const
+  {
+    return m_data == nullptr ? nullptr : m_data + m_stride * team;
+  }
+
+private:
+  static constexpr size_t s_align = 64;
+
+  size_t m_stride;
+  char *m_data{nullptr};
+};
+
 class LaunchContext : public Grid
 {
 public:
+  //! Offset of the next team shared memory allocation
+  size_t shared_mem_offset{0};
+  //! Team shared memory of the team on the host, shared_mem_size bytes
+  char *shared_mem_ptr{nullptr};
+  //! Team of the thread in host teams launches
+  HostTeam *host_team{nullptr};
 
   LaunchContext(Grid const &base)
       : Grid(base)
   {
   }
 
+  /*!
+   * \brief Allocate memory for n objects of type T from the team shared
+   *        memory of the launch, shared_mem_size bytes given by the Grid.
+   *
+   *        Every thread of a team must make the same allocations in the same
+   *        order. The memory is handed back by releaseSharedMemory.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t n)
+  {
+    const size_t align = alignof(T);
+    const size_t offset = (shared_mem_offset + align - 1) / align * align;
+    shared_mem_offset = offset + n * sizeof(T);
+#if defined(RAJA_DEVICE_CODE)
+    extern __shared__ char raja_team_shared_mem[];
+    return reinterpret_cast<T *>(&raja_team_shared_mem[offset]);
+#else
+    if (shared_mem_offset > shared_mem_size || shared_mem_ptr == nullptr) {
+      RAJA_ABORT_OR_THROW(
+          "LaunchContext::getSharedMemory exceeds the shared memory size of "
+          "the launch");
+    }
+    return reinterpret_cast<T *>(shared_mem_ptr + offset);
+#endif
+  }
+
+  //! Hand back all team shared memory allocated with getSharedMemory
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory() { shared_mem_offset = 0; }
+
   RAJA_HOST_DEVICE
   void teamSync()
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#else
+    if (host_team != nullptr && host_team->barrier != nullptr) {
+      host_team->barrier->wait(host_team->size);
+    }
 #endif
   }
 };
@@ -33,5 +33,6 @@
 
 
 #include "RAJA/pattern/tensor/TensorBlock.hpp"
+#include "RAJA/pattern/tensor/BatchedMatrix.hpp"
 
 #endif
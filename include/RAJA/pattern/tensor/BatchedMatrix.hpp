@@ -0,0 +1,495 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining batched small matrix operations on
+ *          SIMD registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_BatchedMatrix_HPP
+#define RAJA_pattern_tensor_BatchedMatrix_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/tensor/TensorRegister.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+  /*!
+   * \brief View of a batch of ROWS x COLS matrices in an interleaved
+   *        (batch SoA) layout.
+   *
+   * Matrices are grouped into blocks of s_lanes matrices, where s_lanes is
+   * the number of elements in a register of REGISTER_POLICY. Within a block
+   * each matrix entry (r,c) is stored for all s_lanes matrices contiguously,
+   * so that one register load gives the same entry of s_lanes matrices, and
+   * each register lane works on its own matrix:
+   *
+   *   data[(m/s_lanes)*s_block_size + (r*COLS + c)*s_lanes + m%s_lanes]
+   *
+   * The data must hold alloc_size(batch_size) elements. Operations work on
+   * whole blocks, so the padding lanes of the last block are computed on
+   * as well and their values are unspecified.
+   */
+  template<typename T,
+           camp::idx_t ROWS,
+           camp::idx_t COLS,
+           typename REGISTER_POLICY = default_register>
+  class BatchedMatrixView
+  {
+    public:
+      using element_type = T;
+      using value_type = typename std::remove_const<T>::type;
+      using register_policy = REGISTER_POLICY;
+      using register_type = Register<value_type, REGISTER_POLICY>;
+
+      static_assert(ROWS >= 1 && ROWS <= 16 && COLS >= 1 && COLS <= 16,
+                    "Batched matrices support 1 to 16 rows and columns");
+
+      static constexpr camp::idx_t s_num_rows = ROWS;
+      static constexpr camp::idx_t s_num_columns = COLS;
+      static constexpr camp::idx_t s_lanes = register_type::s_num_elem;
+      static constexpr camp::idx_t s_block_size = ROWS*COLS*s_lanes;
+
+      /*!
+       * Number of register blocks holding batch_size matrices
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      camp::idx_t num_blocks(camp::idx_t batch_size){
+        return (batch_size + s_lanes - 1) / s_lanes;
+      }
+
+      /*!
+       * Number of elements to allocate for batch_size matrices
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      static
+      constexpr
+      camp::idx_t alloc_size(camp::idx_t batch_size){
+        return num_blocks(batch_size) * s_block_size;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      BatchedMatrixView(T *data, camp::idx_t batch_size) :
+        m_data(data), m_batch_size(batch_size)
+      {}
+
+      /*!
+       * Allows a non-const view to be used where a const view is expected
+       */
+      template<typename T2,
+               typename = typename std::enable_if<
+                   std::is_convertible<T2*, T*>::value>::type>
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      constexpr
+      BatchedMatrixView(
+          BatchedMatrixView<T2, ROWS, COLS, REGISTER_POLICY> const &view) :
+        m_data(view.get_data()), m_batch_size(view.size())
+      {}
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      T &operator()(camp::idx_t matrix, camp::idx_t row, camp::idx_t col) const
+      {
+        return m_data[(matrix/s_lanes)*s_block_size +
+                      (row*COLS + col)*s_lanes + matrix%s_lanes];
+      }
+
+      /*!
+       * Pointer to the first element of a block of s_lanes matrices
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      T *get_block(camp::idx_t block) const
+      {
+        return m_data + block*s_block_size;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      T *get_data() const
+      {
+        return m_data;
+      }
+
+      /*!
+       * Number of matrices in the batch
+       */
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      camp::idx_t size() const
+      {
+        return m_batch_size;
+      }
+
+      RAJA_HOST_DEVICE
+      RAJA_INLINE
+      camp::idx_t get_num_blocks() const
+      {
+        return num_blocks(m_batch_size);
+      }
+
+    private:
+      T *m_data;
+      camp::idx_t m_batch_size;
+  };
+
+}  // namespace expt
+
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Kernels on one block of s_lanes matrices. Entry (r,c) of the block is
+   * the register at block + (r*COLS+c)*s_lanes.
+   */
+  template<typename T, typename REGISTER_POLICY>
+  struct BatchedMatrixBlock
+  {
+      using register_type = RAJA::expt::Register<T, REGISTER_POLICY>;
+      static constexpr camp::idx_t s_lanes = register_type::s_num_elem;
+
+      RAJA_INLINE
+      static
+      register_type load(T const *block, camp::idx_t entry)
+      {
+        register_type value;
+        value.load_packed(block + entry*s_lanes);
+        return value;
+      }
+
+      RAJA_INLINE
+      static
+      void store(T *block, camp::idx_t entry, register_type const &value)
+      {
+        value.store_packed(block + entry*s_lanes);
+      }
+
+      /*!
+       * c = a*b with a M x K and b K x N
+       */
+      template<camp::idx_t M, camp::idx_t N, camp::idx_t K>
+      RAJA_INLINE
+      static
+      void multiply(T *c, T const *a, T const *b)
+      {
+        for(camp::idx_t i = 0;i < M;++ i){
+          register_type c_row[N];
+          register_type a_ik = load(a, i*K);
+          for(camp::idx_t j = 0;j < N;++ j){
+            c_row[j] = a_ik * load(b, j);
+          }
+          for(camp::idx_t k = 1;k < K;++ k){
+            a_ik = load(a, i*K+k);
+            for(camp::idx_t j = 0;j < N;++ j){
+              c_row[j] = a_ik.multiply_add(load(b, k*N+j), c_row[j]);
+            }
+          }
+          for(camp::idx_t j = 0;j < N;++ j){
+            store(c, i*N+j, c_row[j]);
+          }
+        }
+      }
+
+      /*!
+       * In place LU factorization without pivoting. The strictly lower
+       * part holds L, which has a unit diagonal, and the rest holds U.
+       */
+      template<camp::idx_t N>
+      RAJA_INLINE
+      static
+      void lu_factor(T *a)
+      {
+        register_type lu[N*N];
+        for(camp::idx_t e = 0;e < N*N;++ e){
+          lu[e] = load(a, e);
+        }
+
+        register_type one;
+        one.broadcast(T(1));
+
+        for(camp::idx_t p = 0;p < N;++ p){
+          register_type pivot_inv = one / lu[p*N+p];
+          for(camp::idx_t i = p+1;i < N;++ i){
+            register_type l_ip = lu[i*N+p] * pivot_inv;
+            lu[i*N+p] = l_ip;
+            for(camp::idx_t j = p+1;j < N;++ j){
+              lu[i*N+j] -= l_ip * lu[p*N+j];
+            }
+          }
+        }
+
+        for(camp::idx_t e = 0;e < N*N;++ e){
+          store(a, e, lu[e]);
+        }
+      }
+
+      /*!
+       * Solves L*U*x = b in place for the NRHS columns of the N x NRHS x
+       */
+      template<camp::idx_t N, camp::idx_t NRHS>
+      RAJA_INLINE
+      static
+      void lu_solve(T const *lu, T *x)
+      {
+        for(camp::idx_t r = 0;r < NRHS;++ r){
+          register_type y[N];
+          for(camp::idx_t i = 0;i < N;++ i){
+            y[i] = load(x, i*NRHS+r);
+          }
+
+          // forward substitution with the unit lower triangle
+          for(camp::idx_t i = 1;i < N;++ i){
+            for(camp::idx_t p = 0;p < i;++ p){
+              y[i] -= load(lu, i*N+p) * y[p];
+            }
+          }
+
+          // back substitution with the upper triangle
+          for(camp::idx_t i = N-1;i >= 0;-- i){
+            for(camp::idx_t p = i+1;p < N;++ p){
+              y[i] -= load(lu, i*N+p) * y[p];
+            }
+            y[i] = y[i] / load(lu, i*N+i);
+          }
+
+          for(camp::idx_t i = 0;i < N;++ i){
+            store(x, i*NRHS+r, y[i]);
+          }
+        }
+      }
+
+      /*!
+       * inv = a^-1 by Gauss-Jordan elimination without pivoting
+       */
+      template<camp::idx_t N>
+      RAJA_INLINE
+      static
+      void inverse(T *inv, T const *a)
+      {
+        register_type m[N*N];
+        for(camp::idx_t e = 0;e < N*N;++ e){
+          m[e] = load(a, e);
+        }
+
+        register_type one;
+        one.broadcast(T(1));
+
+        for(camp::idx_t p = 0;p < N;++ p){
+          // scale the pivot row, replacing the pivot column with the
+          // corresponding column of the inverse
+          register_type pivot_inv = one / m[p*N+p];
+          m[p*N+p] = one;
+          for(camp::idx_t j = 0;j < N;++ j){
+            m[p*N+j] = m[p*N+j] * pivot_inv;
+          }
+
+          for(camp::idx_t i = 0;i < N;++ i){
+            if(i == p){
+              continue;
+            }
+            register_type f = m[i*N+p];
+            m[i*N+p] = register_type();
+            for(camp::idx_t j = 0;j < N;++ j){
+              m[i*N+j] -= f * m[p*N+j];
+            }
+          }
+        }
+
+        for(camp::idx_t e = 0;e < N*N;++ e){
+          store(inv, e, m[e]);
+        }
+      }
+  };
+
+  template<typename VIEW_A, typename VIEW_B>
+  struct BatchedMatrixCompatible
+  {
+      static constexpr bool value =
+          std::is_same<typename VIEW_A::value_type,
+                       typename VIEW_B::value_type>::value &&
+          std::is_same<typename VIEW_A::register_policy,
+                       typename VIEW_B::register_policy>::value;
+  };
+
+}  // namespace expt
+}  // namespace internal
+
+namespace expt
+{
+
+  /*!
+   * \brief Computes c[m] = a[m] * b[m] for every matrix m of the batch.
+   *
+   * a is M x K, b is K x N and c is M x N. c must not alias a or b.
+   */
+  template<typename EXEC_POL, typename VIEW_C, typename VIEW_A, typename VIEW_B>
+  RAJA_INLINE
+  void batched_matrix_multiply(VIEW_C const &c,
+                               VIEW_A const &a,
+                               VIEW_B const &b)
+  {
+    static_assert(internal::expt::BatchedMatrixCompatible<VIEW_C, VIEW_A>::value &&
+                  internal::expt::BatchedMatrixCompatible<VIEW_C, VIEW_B>::value,
+                  "Batched matrices must have the same element type and register policy");
+    static_assert(VIEW_A::s_num_columns == VIEW_B::s_num_rows &&
+                  VIEW_C::s_num_rows == VIEW_A::s_num_rows &&
+                  VIEW_C::s_num_columns == VIEW_B::s_num_columns,
+                  "Batched matrix dimensions do not match");
+
+    using value_type = typename VIEW_C::value_type;
+    using block_type = internal::expt::BatchedMatrixBlock<
+        value_type, typename VIEW_C::register_policy>;
+    static constexpr camp::idx_t M = VIEW_C::s_num_rows;
+    static constexpr camp::idx_t N = VIEW_C::s_num_columns;
+    static constexpr camp::idx_t K = VIEW_A::s_num_columns;
+
+    value_type *c_data = c.get_data();
+    value_type const *a_data = a.get_data();
+    value_type const *b_data = b.get_data();
+
+    RAJA::forall<EXEC_POL>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, c.get_num_blocks()),
+        [=](camp::idx_t block){
+          block_type::template multiply<M, N, K>(
+              c_data + block*VIEW_C::s_block_size,
+              a_data + block*VIEW_A::s_block_size,
+              b_data + block*VIEW_B::s_block_size);
+        });
+  }
+
+  /*!
+   * \brief Factors every N x N matrix of the batch in place as a = L*U.
+   *
+   * No pivoting is done, so the matrices must have non-singular leading
+   * principal minors, as diagonally dominant or symmetric positive
+   * definite matrices do.
+   */
+  template<typename EXEC_POL, typename VIEW_A>
+  RAJA_INLINE
+  void batched_lu_factor(VIEW_A const &a)
+  {
+    static_assert(VIEW_A::s_num_rows == VIEW_A::s_num_columns &&
+                  VIEW_A::s_num_rows >= 2,
+                  "Batched LU factorization requires square matrices of size 2 to 16");
+
+    using value_type = typename VIEW_A::value_type;
+    using block_type = internal::expt::BatchedMatrixBlock<
+        value_type, typename VIEW_A::register_policy>;
+    static constexpr camp::idx_t N = VIEW_A::s_num_rows;
+
+    value_type *a_data = a.get_data();
+
+    RAJA::forall<EXEC_POL>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, a.get_num_blocks()),
+        [=](camp::idx_t block){
+          block_type::template lu_factor<N>(
+              a_data + block*VIEW_A::s_block_size);
+        });
+  }
+
+  /*!
+   * \brief Solves lu[m] * x[m] = b[m] in place for every matrix m of the
+   *        batch, where x holds b on entry and lu is from batched_lu_factor.
+   *
+   * x is N x NRHS, so a batch of vectors is a view with one column.
+   */
+  template<typename EXEC_POL, typename VIEW_LU, typename VIEW_X>
+  RAJA_INLINE
+  void batched_lu_solve(VIEW_LU const &lu, VIEW_X const &x)
+  {
+    static_assert(internal::expt::BatchedMatrixCompatible<VIEW_LU, VIEW_X>::value,
+                  "Batched matrices must have the same element type and register policy");
+    static_assert(VIEW_LU::s_num_rows == VIEW_LU::s_num_columns &&
+                  VIEW_LU::s_num_rows >= 2,
+                  "Batched LU solve requires square matrices of size 2 to 16");
+    static_assert(VIEW_X::s_num_rows == VIEW_LU::s_num_rows,
+                  "Batched matrix dimensions do not match");
+
+    using value_type = typename VIEW_X::value_type;
+    using block_type = internal::expt::BatchedMatrixBlock<
+        value_type, typename VIEW_X::register_policy>;
+    static constexpr camp::idx_t N = VIEW_LU::s_num_rows;
+    static constexpr camp::idx_t NRHS = VIEW_X::s_num_columns;
+
+    value_type const *lu_data = lu.get_data();
+    value_type *x_data = x.get_data();
+
+    RAJA::forall<EXEC_POL>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, x.get_num_blocks()),
+        [=](camp::idx_t block){
+          block_type::template lu_solve<N, NRHS>(
+              lu_data + block*VIEW_LU::s_block_size,
+              x_data + block*VIEW_X::s_block_size);
+        });
+  }
+
+  /*!
+   * \brief Computes inv[m] = a[m]^-1 for every N x N matrix m of the batch.
+   *
+   * Uses Gauss-Jordan elimination without pivoting, with the same
+   * requirements on the matrices as batched_lu_factor. inv may alias a.
+   */
+  template<typename EXEC_POL, typename VIEW_INV, typename VIEW_A>
+  RAJA_INLINE
+  void batched_matrix_inverse(VIEW_INV const &inv, VIEW_A const &a)
+  {
+    static_assert(internal::expt::BatchedMatrixCompatible<VIEW_INV, VIEW_A>::value,
+                  "Batched matrices must have the same element type and register policy");
+    static_assert(VIEW_A::s_num_rows == VIEW_A::s_num_columns &&
+                  VIEW_A::s_num_rows >= 2,
+                  "Batched matrix inverse requires square matrices of size 2 to 16");
+    static_assert(VIEW_INV::s_num_rows == VIEW_A::s_num_rows &&
+                  VIEW_INV::s_num_columns == VIEW_A::s_num_columns,
+                  "Batched matrix dimensions do not match");
+
+    using value_type = typename VIEW_A::value_type;
+    using block_type = internal::expt::BatchedMatrixBlock<
+        value_type, typename VIEW_A::register_policy>;
+    static constexpr camp::idx_t N = VIEW_A::s_num_rows;
+
+    value_type *inv_data = inv.get_data();
+    value_type const *a_data = a.get_data();
+
+    RAJA::forall<EXEC_POL>(
+        RAJA::TypedRangeSegment<camp::idx_t>(0, a.get_num_blocks()),
+        [=](camp::idx_t block){
+          block_type::template inverse<N>(
+              inv_data + block*VIEW_INV::s_block_size,
+              a_data + block*VIEW_A::s_block_size);
+        });
+  }
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
 #include "RAJA/pattern/tensor/internal/TensorTileExec.hpp"
+#include "RAJA/pattern/tensor/internal/PackedMatrixMultiply.hpp"
 
 
 namespace RAJA
@@ -213,6 +214,16 @@ namespace expt
           printf("Load()");
         }
 
+        /*!
+         * Returns the reference to the loaded or stored data
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        ref_type const &getRef() const {
+          return m_ref;
+        }
+
       private:
 
         RAJA_INLINE
@@ -233,6 +244,13 @@ namespace expt
           printf(")\n");
 #endif
 
+#if !defined(RAJA_DEVICE_CODE)
+          // large matrix products use a packed multiply on the CPU
+          if(PackedMultiplyStore<tensor_type, RHS>::store(m_ref, rhs)){
+            return;
+          }
+#endif
+
           tensorTileExec<tensor_type>(m_ref.m_tile,
               makeTensorStoreFunctor<tensor_type>(*this, rhs));
         }
@@ -79,6 +79,37 @@ namespace expt
         }
 
 
+        /*!
+         * Returns the left operand of the multiply
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        left_operand_type const &getLeftOperand() const {
+          return m_left_operand;
+        }
+
+        /*!
+         * Returns the right operand of the multiply
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        right_operand_type const &getRightOperand() const {
+          return m_right_operand;
+        }
+
+        /*!
+         * Returns the operand that is added to the product
+         */
+        RAJA_INLINE
+        RAJA_HOST_DEVICE
+        constexpr
+        add_operand_type const &getAddOperand() const {
+          return m_add_operand;
+        }
+
+
         RAJA_INLINE
         RAJA_HOST_DEVICE
         void print_ast() const {
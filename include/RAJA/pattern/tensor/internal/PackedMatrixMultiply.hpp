@@ -0,0 +1,547 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the packed, register-blocked CPU
+ *          matrix-matrix multiply used for large A*B tensor expressions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_tensor_PackedMatrixMultiply_HPP
+#define RAJA_pattern_tensor_PackedMatrixMultiply_HPP
+
+#include "RAJA/config.hpp"
+
+#include <memory>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/policy/tensor/arch.hpp"
+
+#include "RAJA/pattern/tensor/internal/TensorRef.hpp"
+#include "RAJA/pattern/tensor/internal/ET/ExpressionTemplateBase.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+namespace expt
+{
+
+  /*!
+   * Shape of the block of C that the packed multiply micro-kernel keeps in
+   * registers: s_mr rows by s_nr_registers registers of columns.
+   *
+   * Register policies without a specialization don't use the packed
+   * multiply.
+   */
+  template<typename REGISTER_POLICY>
+  struct PackedMatrixMultiplyShape
+  {
+      static constexpr bool s_enabled = false;
+      static constexpr camp::idx_t s_mr = 1;
+      static constexpr camp::idx_t s_nr_registers = 1;
+  };
+
+  template<>
+  struct PackedMatrixMultiplyShape<RAJA::expt::scalar_register>
+  {
+      static constexpr bool s_enabled = true;
+      static constexpr camp::idx_t s_mr = 4;
+      static constexpr camp::idx_t s_nr_registers = 4;
+  };
+
+#ifdef __AVX__
+  // 12 accumulators, 2 B registers and 1 broadcast of the 16 YMM registers
+  template<>
+  struct PackedMatrixMultiplyShape<RAJA::expt::avx_register>
+  {
+      static constexpr bool s_enabled = true;
+      static constexpr camp::idx_t s_mr = 6;
+      static constexpr camp::idx_t s_nr_registers = 2;
+  };
+#endif
+
+#ifdef __AVX2__
+  template<>
+  struct PackedMatrixMultiplyShape<RAJA::expt::avx2_register>
+  {
+      static constexpr bool s_enabled = true;
+      static constexpr camp::idx_t s_mr = 6;
+      static constexpr camp::idx_t s_nr_registers = 2;
+  };
+#endif
+
+#ifdef __AVX512F__
+  // 24 accumulators, 3 B registers and 1 broadcast of the 32 ZMM registers
+  template<>
+  struct PackedMatrixMultiplyShape<RAJA::expt::avx512_register>
+  {
+      static constexpr bool s_enabled = true;
+      static constexpr camp::idx_t s_mr = 8;
+      static constexpr camp::idx_t s_nr_registers = 3;
+  };
+#endif
+
+
+  /*!
+   * Packed matrix-matrix multiply C = A*B (or C += A*B) for matrices with
+   * arbitrary row and column strides.
+   *
+   * Following the usual blocking of optimized BLAS, a kc x nc panel of B and
+   * an mc x kc block of A are copied into aligned, contiguous buffers laid
+   * out in the order the micro-kernel reads them, padded with zeros to full
+   * micro-tiles. The micro-kernel multiplies an mr x kc sliver of A by a
+   * kc x nr sliver of B, keeping the mr x nr block of C in registers.
+   */
+  template<typename T, typename REGISTER_POLICY>
+  struct PackedMatrixMultiply
+  {
+      using element_type = T;
+      using register_type = RAJA::expt::Register<T, REGISTER_POLICY>;
+      using shape = PackedMatrixMultiplyShape<REGISTER_POLICY>;
+
+      static constexpr camp::idx_t s_width = register_type::s_num_elem;
+      static constexpr camp::idx_t s_mr = shape::s_mr;
+      static constexpr camp::idx_t s_nr_registers = shape::s_nr_registers;
+      static constexpr camp::idx_t s_nr = s_width * s_nr_registers;
+
+      // kc x nr sliver of B in L1, mc x kc block of A in L2
+      static constexpr camp::idx_t s_kc = 2048 / sizeof(T);
+      static constexpr camp::idx_t s_mc = s_mr * (96 / s_mr);
+      static constexpr camp::idx_t s_nc = s_nr * (1024 / s_nr);
+
+
+      static
+      void multiply(camp::idx_t m, camp::idx_t n, camp::idx_t k,
+                    T const *a, camp::idx_t a_rs, camp::idx_t a_cs,
+                    T const *b, camp::idx_t b_rs, camp::idx_t b_cs,
+                    T *c, camp::idx_t c_rs, camp::idx_t c_cs,
+                    bool accumulate)
+      {
+        if(m <= 0 || n <= 0){
+          return;
+        }
+        if(k <= 0){
+          if(!accumulate){
+            for(camp::idx_t i = 0;i < m;++ i){
+              for(camp::idx_t j = 0;j < n;++ j){
+                c[i*c_rs + j*c_cs] = T(0);
+              }
+            }
+          }
+          return;
+        }
+
+        Buffers &buffers = get_buffers();
+        T *a_pack = buffers.get_a(s_mc*s_kc);
+        T *b_pack = buffers.get_b(s_kc*s_nc);
+
+        alignas(64) T c_block[s_mr*s_nr];
+
+        for(camp::idx_t jc = 0;jc < n;jc += s_nc){
+          camp::idx_t nc = min_size(s_nc, n-jc);
+
+          for(camp::idx_t pc = 0;pc < k;pc += s_kc){
+            camp::idx_t kc = min_size(s_kc, k-pc);
+
+            pack_b(kc, nc, b + pc*b_rs + jc*b_cs, b_rs, b_cs, b_pack);
+
+            // the first panel in k overwrites C unless accumulating
+            bool add_c = accumulate || pc > 0;
+
+            for(camp::idx_t ic = 0;ic < m;ic += s_mc){
+              camp::idx_t mc = min_size(s_mc, m-ic);
+
+              pack_a(mc, kc, a + ic*a_rs + pc*a_cs, a_rs, a_cs, a_pack);
+
+              for(camp::idx_t jr = 0;jr < nc;jr += s_nr){
+                camp::idx_t nr = min_size(s_nr, nc-jr);
+
+                for(camp::idx_t ir = 0;ir < mc;ir += s_mr){
+                  camp::idx_t mr = min_size(s_mr, mc-ir);
+
+                  micro_kernel(kc, a_pack + ir*kc, b_pack + jr*kc, c_block);
+
+                  T *c_tile = c + (ic+ir)*c_rs + (jc+jr)*c_cs;
+                  for(camp::idx_t i = 0;i < mr;++ i){
+                    for(camp::idx_t j = 0;j < nr;++ j){
+                      T &c_ij = c_tile[i*c_rs + j*c_cs];
+                      c_ij = add_c ? c_ij + c_block[i*s_nr + j]
+                                   : c_block[i*s_nr + j];
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+
+      /*!
+       * Computes the mr x nr block a*b of packed slivers into c_block,
+       * which is row-major with row stride s_nr.
+       */
+      RAJA_INLINE
+      static
+      void micro_kernel(camp::idx_t kc, T const *a, T const *b, T *c_block)
+      {
+        register_type acc[s_mr][s_nr_registers];
+
+        for(camp::idx_t p = 0;p < kc;++ p){
+          register_type b_p[s_nr_registers];
+          for(camp::idx_t r = 0;r < s_nr_registers;++ r){
+            b_p[r].load_packed(b + p*s_nr + r*s_width);
+          }
+          for(camp::idx_t i = 0;i < s_mr;++ i){
+            register_type a_ip(a[p*s_mr + i]);
+            for(camp::idx_t r = 0;r < s_nr_registers;++ r){
+              acc[i][r] = a_ip.multiply_add(b_p[r], acc[i][r]);
+            }
+          }
+        }
+
+        for(camp::idx_t i = 0;i < s_mr;++ i){
+          for(camp::idx_t r = 0;r < s_nr_registers;++ r){
+            acc[i][r].store_packed(c_block + i*s_nr + r*s_width);
+          }
+        }
+      }
+
+
+      /*!
+       * Copies an mc x kc block of A into slivers of s_mr rows, each stored
+       * column by column.
+       */
+      static
+      void pack_a(camp::idx_t mc, camp::idx_t kc,
+                  T const *a, camp::idx_t a_rs, camp::idx_t a_cs,
+                  T *a_pack)
+      {
+        for(camp::idx_t ir = 0;ir < mc;ir += s_mr){
+          camp::idx_t mr = min_size(s_mr, mc-ir);
+          T *sliver = a_pack + ir*kc;
+          for(camp::idx_t p = 0;p < kc;++ p){
+            for(camp::idx_t i = 0;i < s_mr;++ i){
+              sliver[p*s_mr + i] = i < mr ? a[(ir+i)*a_rs + p*a_cs] : T(0);
+            }
+          }
+        }
+      }
+
+      /*!
+       * Copies a kc x nc panel of B into slivers of s_nr columns, each
+       * stored row by row.
+       */
+      static
+      void pack_b(camp::idx_t kc, camp::idx_t nc,
+                  T const *b, camp::idx_t b_rs, camp::idx_t b_cs,
+                  T *b_pack)
+      {
+        for(camp::idx_t jr = 0;jr < nc;jr += s_nr){
+          camp::idx_t nr = min_size(s_nr, nc-jr);
+          T *sliver = b_pack + jr*kc;
+          for(camp::idx_t p = 0;p < kc;++ p){
+            for(camp::idx_t j = 0;j < s_nr;++ j){
+              sliver[p*s_nr + j] = j < nr ? b[p*b_rs + (jr+j)*b_cs] : T(0);
+            }
+          }
+        }
+      }
+
+    private:
+
+      // by value, so the static constexpr sizes aren't odr-used
+      RAJA_INLINE
+      static
+      camp::idx_t min_size(camp::idx_t a, camp::idx_t b)
+      {
+        return b < a ? b : a;
+      }
+
+      using buffer_ptr = std::unique_ptr<T, RAJA::FreeAligned>;
+
+      // Packing buffers, kept per thread and reused between multiplies
+      struct Buffers
+      {
+          buffer_ptr a;
+          buffer_ptr b;
+
+          T *get_a(camp::idx_t size){
+            return get(a, size);
+          }
+
+          T *get_b(camp::idx_t size){
+            return get(b, size);
+          }
+
+        private:
+          static T *get(buffer_ptr &buffer, camp::idx_t size){
+            if(!buffer){
+              buffer.reset(RAJA::allocate_aligned_type<T>(
+                  RAJA::DATA_ALIGN, size*sizeof(T)));
+              if(!buffer){
+                RAJA_ABORT_OR_THROW("PackedMatrixMultiply buffer allocation failed");
+              }
+            }
+            return buffer.get();
+          }
+      };
+
+      static Buffers &get_buffers(){
+        static thread_local Buffers buffers;
+        return buffers;
+      }
+  };
+
+
+  namespace ET
+  {
+
+    template<typename LEFT_OPERAND_TYPE, typename RIGHT_OPERAND_TYPE, typename ADD_OPERAND_TYPE>
+    class TensorMultiplyAdd;
+
+
+    /*!
+     * Selects the tensor register types whose products are computed with
+     * PackedMatrixMultiply: floating point matrices on CPU register
+     * policies.
+     */
+    template<typename TENSOR_TYPE, class ENABLE = void>
+    struct PackedMultiplyTensorTraits
+    {
+        static constexpr bool s_enabled = false;
+    };
+
+    template<typename TENSOR_TYPE>
+    struct PackedMultiplyTensorTraits<TENSOR_TYPE,
+    typename std::enable_if<
+    std::is_base_of<TensorRegisterConcreteBase, TENSOR_TYPE>::value &&
+    TENSOR_TYPE::s_num_dims == 2>::type>
+    {
+        using element_type = typename TENSOR_TYPE::element_type;
+        using register_policy = typename TENSOR_TYPE::register_policy;
+
+        static constexpr bool s_enabled =
+            std::is_floating_point<element_type>::value &&
+            PackedMatrixMultiplyShape<register_policy>::s_enabled;
+    };
+
+
+    /*!
+     * Stores the expression RHS into the matrix referenced by a
+     * TensorLoadStore with a packed multiply when RHS is A*B or A*B + C of
+     * matrix loads, with C the stored matrix, and the product is large.
+     *
+     * The default returns false and the caller evaluates RHS tile by tile.
+     */
+    template<typename TENSOR_TYPE, typename RHS, class ENABLE = void>
+    struct PackedMultiplyStore
+    {
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        bool store(REF_TYPE const &, RHS const &)
+        {
+          return false;
+        }
+    };
+
+
+    template<typename TENSOR_TYPE>
+    struct PackedMultiplyStoreBase
+    {
+        using element_type = typename TENSOR_TYPE::element_type;
+        using register_policy = typename TENSOR_TYPE::register_policy;
+        using multiply_type = PackedMatrixMultiply<element_type, register_policy>;
+
+        // smaller products are fast enough from registers
+        static constexpr camp::idx_t s_min_volume = 64*64*64;
+
+
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        camp::idx_t size(REF_TYPE const &ref, camp::idx_t dim)
+        {
+          return camp::idx_t(ref.m_tile.m_size[dim]);
+        }
+
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        camp::idx_t begin(REF_TYPE const &ref, camp::idx_t dim)
+        {
+          return camp::idx_t(ref.m_tile.m_begin[dim]);
+        }
+
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        camp::idx_t stride(REF_TYPE const &ref, camp::idx_t dim)
+        {
+          return camp::idx_t(ref.m_stride[dim]);
+        }
+
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        element_type const *first(REF_TYPE const &ref)
+        {
+          return ref.m_pointer + begin(ref, 0)*stride(ref, 0) +
+                                 begin(ref, 1)*stride(ref, 1);
+        }
+
+        template<typename REF_TYPE>
+        RAJA_INLINE
+        static
+        element_type const *last(REF_TYPE const &ref)
+        {
+          return first(ref) + (size(ref, 0)-1)*stride(ref, 0) +
+                              (size(ref, 1)-1)*stride(ref, 1);
+        }
+
+        template<typename REF1, typename REF2>
+        RAJA_INLINE
+        static
+        bool overlap(REF1 const &ref1, REF2 const &ref2)
+        {
+          return !(last(ref1) < first(ref2) || last(ref2) < first(ref1));
+        }
+
+        template<typename REF1, typename REF2>
+        RAJA_INLINE
+        static
+        bool same_matrix(REF1 const &ref1, REF2 const &ref2)
+        {
+          return first(ref1) == first(ref2) &&
+                 size(ref1, 0) == size(ref2, 0) &&
+                 size(ref1, 1) == size(ref2, 1) &&
+                 stride(ref1, 0) == stride(ref2, 0) &&
+                 stride(ref1, 1) == stride(ref2, 1);
+        }
+
+        /*!
+         * Computes C = A*B or C += A*B if the extents form a large, full
+         * product of matrices that don't overlap C, and returns false
+         * otherwise.
+         *
+         * Like the tiled evaluation, the rows of A and columns of B follow
+         * those of C and k starts at 0, so only loads with those offsets
+         * are accepted.
+         */
+        template<typename C_REF, typename A_REF, typename B_REF>
+        static
+        bool multiply(C_REF const &c, A_REF const &a, B_REF const &b,
+                      bool accumulate)
+        {
+          camp::idx_t m = size(c, 0);
+          camp::idx_t n = size(c, 1);
+          camp::idx_t k = size(a, 1);
+
+          if(m <= 0 || n <= 0 || k <= 0 || m*n*k < s_min_volume){
+            return false;
+          }
+          if(size(a, 0) != m || size(b, 0) != k || size(b, 1) != n ||
+             begin(a, 0) != begin(c, 0) || begin(a, 1) != 0 ||
+             begin(b, 0) != 0 || begin(b, 1) != begin(c, 1)){
+            return false;
+          }
+          if(overlap(c, a) || overlap(c, b)){
+            return false;
+          }
+
+          multiply_type::multiply(m, n, k,
+                                  first(a), stride(a, 0), stride(a, 1),
+                                  first(b), stride(b, 0), stride(b, 1),
+                                  const_cast<element_type *>(first(c)),
+                                  stride(c, 0), stride(c, 1),
+                                  accumulate);
+          return true;
+        }
+    };
+
+
+    /*
+     * C = A*B
+     */
+    template<typename TENSOR_TYPE,
+             typename A_TENSOR, typename A_REF, typename B_TENSOR, typename B_REF>
+    struct PackedMultiplyStore<TENSOR_TYPE,
+    TensorMultiply<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>>,
+    typename std::enable_if<
+    PackedMultiplyTensorTraits<TENSOR_TYPE>::s_enabled &&
+    PackedMultiplyTensorTraits<A_TENSOR>::s_enabled &&
+    PackedMultiplyTensorTraits<B_TENSOR>::s_enabled &&
+    std::is_same<typename TENSOR_TYPE::element_type, typename A_TENSOR::element_type>::value &&
+    std::is_same<typename TENSOR_TYPE::element_type, typename B_TENSOR::element_type>::value>::type> :
+    public PackedMultiplyStoreBase<TENSOR_TYPE>
+    {
+        template<typename REF_TYPE, typename RHS>
+        static
+        bool store(REF_TYPE const &ref, RHS const &rhs)
+        {
+          return PackedMultiplyStoreBase<TENSOR_TYPE>::multiply(
+              ref,
+              rhs.getLeftOperand().getRef(),
+              rhs.getRightOperand().getRef(),
+              false);
+        }
+    };
+
+
+    /*
+     * C = A*B + C, which is also what C += A*B produces
+     */
+    template<typename TENSOR_TYPE,
+             typename A_TENSOR, typename A_REF, typename B_TENSOR, typename B_REF,
+             typename ADD_REF>
+    struct PackedMultiplyStore<TENSOR_TYPE,
+    TensorMultiplyAdd<TensorLoadStore<A_TENSOR, A_REF>, TensorLoadStore<B_TENSOR, B_REF>,
+                      TensorLoadStore<TENSOR_TYPE, ADD_REF>>,
+    typename std::enable_if<
+    PackedMultiplyTensorTraits<TENSOR_TYPE>::s_enabled &&
+    PackedMultiplyTensorTraits<A_TENSOR>::s_enabled &&
+    PackedMultiplyTensorTraits<B_TENSOR>::s_enabled &&
+    std::is_same<typename TENSOR_TYPE::element_type, typename A_TENSOR::element_type>::value &&
+    std::is_same<typename TENSOR_TYPE::element_type, typename B_TENSOR::element_type>::value>::type> :
+    public PackedMultiplyStoreBase<TENSOR_TYPE>
+    {
+        template<typename REF_TYPE, typename RHS>
+        static
+        bool store(REF_TYPE const &ref, RHS const &rhs)
+        {
+          using base = PackedMultiplyStoreBase<TENSOR_TYPE>;
+          if(!base::same_matrix(ref, rhs.getAddOperand().getRef())){
+            return false;
+          }
+          return base::multiply(ref,
+                                rhs.getLeftOperand().getRef(),
+                                rhs.getRightOperand().getRef(),
+                                true);
+        }
+    };
+
+  } // namespace ET
+
+} // namespace expt
+} // namespace internal
+}  // namespace RAJA
+
+
+#endif
@@ -22,6 +22,7 @@
 #include "RAJA/util/concepts.hpp"
 
 #include <cstddef>
+#include <type_traits>
 
 namespace RAJA
 {
@@ -124,6 +125,22 @@ struct ordered {
 
 }  // namespace reduce
 
+namespace policy
+{
+namespace indexset
+{
+
+///
+/// Base class of segment iteration policies that flatten the iterations
+/// of all segments of an index set into one iteration space and split it
+/// across threads regardless of segment boundaries.
+///
+struct flatten_segit_base {
+};
+
+}  // end namespace indexset
+}  // end namespace policy
+
 
 template <Policy Pol, Pattern Pat, typename... Args>
 using make_policy_pattern_t =
@@ -205,6 +222,12 @@ struct is_device_exec_policy
     : RAJA::policy_any_of<Pol, RAJA::Policy::cuda, RAJA::Policy::hip> {
 };
 
+template <typename Pol>
+struct is_flatten_segit
+    : std::is_base_of<RAJA::policy::indexset::flatten_segit_base,
+                      camp::decay<Pol>> {
+};
+
 DefineTypeTraitFromConcept(is_execution_policy,
                            RAJA::concepts::ExecutionPolicy);
 
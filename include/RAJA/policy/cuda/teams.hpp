@@ -75,7 +75,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -129,7 +129,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 1>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -199,7 +199,7 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -253,7 +253,7 @@ struct LaunchExecute<RAJA::policy::cuda::expt::cuda_launch_explicit_t<async, nth
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -74,7 +74,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -127,7 +127,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -195,7 +195,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
@@ -248,7 +248,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem_size;
 
       {
         //
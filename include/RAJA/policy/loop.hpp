@@ -24,6 +24,7 @@
     #include "RAJA/policy/loop/atomic.hpp"
 #endif
 
+#include "RAJA/policy/loop/compaction.hpp"
 #include "RAJA/policy/loop/forall.hpp"
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
@@ -0,0 +1,134 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA copy_if, partition and unique
+*          declarations for the loop back-end.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compaction_loop_HPP
+#define RAJA_compaction_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/compaction.hpp"
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compaction
+{
+
+/*!
+        \brief copy the elements of the input range for which pred is true to
+   out, giving the number of elements copied
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+copy_if(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    Predicate pred)
+{
+  const size_t count = RAJA::detail::copy_if(RAJA::detail::SequentialChunkExecutor{},
+      begin, end, out, pred);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             count);
+}
+
+/*!
+        \brief partition given range inplace so elements for which pred is true
+   come first, giving the number of those elements
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+partition(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Predicate pred)
+{
+  const size_t count = RAJA::detail::partition(RAJA::detail::SequentialChunkExecutor{},
+      begin, end, pred);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             count);
+}
+
+/*!
+        \brief stable partition given range inplace so elements for which pred
+   is true come first, giving the number of those elements
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+stable_partition(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Predicate pred)
+{
+  const size_t count = RAJA::detail::stable_partition(RAJA::detail::SequentialChunkExecutor{},
+      begin, end, pred);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             count);
+}
+
+/*!
+        \brief remove inplace all but the first of each run of equal elements in
+   given range, giving the number of elements kept
+*/
+template <typename ExecPolicy, typename Iter, typename BinaryPredicate>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+unique(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    BinaryPredicate eq)
+{
+  const size_t count = RAJA::detail::unique(RAJA::detail::SequentialChunkExecutor{},
+      begin, end, eq);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             count);
+}
+
+}  // namespace compaction
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -32,6 +32,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/params/forall.hpp"
+
 using RAJA::concepts::enable_if;
 
 namespace RAJA
@@ -65,6 +67,27 @@ RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
   }
   return RAJA::resources::EventProxy<Resource>(res);
 }
+
+///
+/// Loop policy implementation with forall parameters
+///
+template <typename Iterable, typename Func, typename Resource,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(
+    Resource res,
+    const loop_exec &,
+    Iterable &&iter,
+    Func &&body,
+    expt::ForallParamPack<Params...> &params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    expt::invoke_body(params, body, *(begin_it + i));
+  }
+  expt::resolve_params(params);
+  return RAJA::resources::EventProxy<Resource>(res);
+}
 }  // namespace loop
 
 }  // namespace policy
@@ -27,6 +27,8 @@
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/segmented_scan.hpp"
 
 #include "RAJA/policy/loop/policy.hpp"
 
@@ -156,6 +158,95 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<true>(RAJA::detail::SequentialChunkExecutor{},
+                                     segments, begin, end, out, f,
+                                     ValueT(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segments,
+   output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<false>(RAJA::detail::SequentialChunkExecutor{},
+                                      segments, begin, end, out, f,
+                                      ValueT(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduction of each segment given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_loop_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy &,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  const size_t num_segments =
+      RAJA::detail::reduce_by_key(RAJA::detail::SequentialChunkExecutor{},
+                                  segments, begin, end, out, f);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             num_segments);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -32,6 +32,8 @@
 
 #include "RAJA/util/sort.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
+
 #include "RAJA/policy/loop/policy.hpp"
 
 namespace RAJA
@@ -87,7 +89,9 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::UnstableSorter{}(begin, end, comp);
+  RAJA::detail::radix_sort_or(RAJA::detail::SequentialChunkExecutor{},
+                              detail::UnstableSorter{},
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -105,7 +109,9 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::StableSorter{}(begin, end, comp);
+  RAJA::detail::radix_sort_or(RAJA::detail::SequentialChunkExecutor{},
+                              detail::StableSorter{},
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -124,10 +130,16 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin = RAJA::zip(kb, vb);
+    auto end = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(RAJA::detail::SequentialChunkExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -146,10 +158,16 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin = RAJA::zip(kb, vb);
+    auto end = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(RAJA::detail::SequentialChunkExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
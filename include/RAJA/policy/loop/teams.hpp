@@ -46,14 +46,18 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    HostTeamSharedMem shared_mem(ctx.shared_mem_size, 1);
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.get(0);
+
+    body(team_ctx);
   }
 
   template <typename BODY>
   static resources::EventProxy<resources::Resource>
   exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    exec(ctx, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
@@ -33,8 +33,10 @@
     #include "RAJA/policy/openmp/atomic.hpp"
 #endif
 
+#include "RAJA/policy/openmp/compaction.hpp"
 #include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
+#include "RAJA/policy/openmp/persistent_team.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
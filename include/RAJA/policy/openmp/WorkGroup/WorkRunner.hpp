@@ -20,8 +20,18 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -75,6 +85,265 @@ struct WorkRunner<
         Args...>
 { };
 
+
+/*!
+ * A body and segment holder for storing loops that are run a range of
+ * iterations at a time by the OpenMP single region runners
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpRange
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpRange(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  // run iterations [i_begin, i_end) of the loop
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(m_body);
+    auto& body = privatizer.get_priv();
+
+    const auto begin = m_segment.begin();
+    for (index_type i = i_begin; i < i_end; ++i) {
+      body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Base class describing storage for the OpenMP runners that run all the
+ * loops in one parallel region
+ *
+ * Keeps the end of each loop in the iteration space of all the loops joined
+ * end to end in enqueue order.
+ */
+template <typename ORDER_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunnerOmpSingleRegion_base
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = ORDER_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  using vtable_type = Vtable<void, index_type, index_type, Args...>;
+
+  WorkRunnerOmpSingleRegion_base() = default;
+
+  WorkRunnerOmpSingleRegion_base(WorkRunnerOmpSingleRegion_base const&) = delete;
+  WorkRunnerOmpSingleRegion_base& operator=(WorkRunnerOmpSingleRegion_base const&) = delete;
+
+  WorkRunnerOmpSingleRegion_base(WorkRunnerOmpSingleRegion_base &&) = default;
+  WorkRunnerOmpSingleRegion_base& operator=(WorkRunnerOmpSingleRegion_base &&) = default;
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename segment_type, typename loop_type >
+  using holder_type = HoldOmpRange<segment_type, loop_type, index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host by the team threads
+  using vtable_exec_policy = RAJA::loop_work;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename segment_T, typename loop_T >
+  inline void enqueue(WorkContainer& storage, segment_T&& seg, loop_T&& loop)
+  {
+    using holder = holder_type<camp::decay<segment_T>, camp::decay<loop_T>>;
+
+    const index_type len =
+        static_cast<index_type>(std::distance(std::begin(seg), std::end(seg)));
+    m_loop_ends.push_back(num_iterations() + len);
+
+    storage.template emplace<holder>(
+        get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+        std::forward<segment_T>(seg), std::forward<loop_T>(loop));
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_loop_ends.clear();
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+protected:
+  index_type num_iterations() const
+  {
+    return m_loop_ends.empty() ? index_type(0) : m_loop_ends.back();
+  }
+
+  std::vector<index_type> m_loop_ends;
+};
+
+/*!
+ * Runs work in a storage container in order in one parallel region,
+ * dividing each loop statically among the threads with a barrier between
+ * loops
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::ordered_omp_single_region,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpSingleRegion_base<
+        RAJA::ordered_omp_single_region,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerOmpSingleRegion_base<
+        RAJA::ordered_omp_single_region,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using index_type = INDEX_T;
+  using per_run_storage = typename base::per_run_storage;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    const index_type num_loops = static_cast<index_type>(this->m_loop_ends.size());
+    if (num_loops == index_type(0)) {
+      return run_storage;
+    }
+
+    const auto begin = storage.begin();
+    const index_type* loop_ends = this->m_loop_ends.data();
+
+#pragma omp parallel
+    {
+      const int num_threads = omp_get_num_threads();
+      const int tid = omp_get_thread_num();
+
+      for (index_type k = 0; k < num_loops; ++k) {
+        if (k > index_type(0)) {
+#pragma omp barrier
+        }
+        const index_type loop_begin = k > index_type(0) ? loop_ends[k-1] : index_type(0);
+        const index_type len = loop_ends[k] - loop_begin;
+        const index_type lo = RAJA::detail::firstIndex(len, num_threads, tid);
+        const index_type hi = RAJA::detail::firstIndex(len, num_threads, tid + 1);
+        if (lo < hi) {
+          value_type::call(&begin[k], lo, hi, args...);
+        }
+      }
+    }
+
+    return run_storage;
+  }
+};
+
+/*!
+ * Runs work in a storage container in no particular order in one parallel
+ * region, with threads claiming chunks of the iteration space of all the
+ * loops joined end to end so small loops share threads and no thread waits
+ * at the end of a loop
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::unordered_omp_flattened_chunks,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+    : WorkRunnerOmpSingleRegion_base<
+        RAJA::unordered_omp_flattened_chunks,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using base = WorkRunnerOmpSingleRegion_base<
+        RAJA::unordered_omp_flattened_chunks,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using index_type = INDEX_T;
+  using per_run_storage = typename base::per_run_storage;
+
+  //! Number of chunks per thread the iteration space is split into
+  static constexpr int chunks_per_thread = 4;
+
+  //! Smallest chunk, so threads do not share cache lines at chunk edges
+  static constexpr int min_chunk_size = 64;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    const index_type total = this->num_iterations();
+    if (total == index_type(0)) {
+      return run_storage;
+    }
+
+    const auto begin = storage.begin();
+    const index_type* loop_ends = this->m_loop_ends.data();
+    std::atomic<index_type> next_chunk{index_type(0)};
+
+#pragma omp parallel
+    {
+      const index_type num_chunks =
+          static_cast<index_type>(omp_get_num_threads() * chunks_per_thread);
+      const index_type chunk = std::max(static_cast<index_type>(min_chunk_size),
+                                        (total + num_chunks - 1) / num_chunks);
+
+      // each thread claims chunks in increasing order, so its loop number
+      // only moves forward
+      index_type k = 0;
+      for (index_type start = next_chunk.fetch_add(chunk); start < total;
+           start = next_chunk.fetch_add(chunk)) {
+        const index_type stop = std::min(start + chunk, total);
+        while (loop_ends[k] <= start) {
+          ++k;
+        }
+        // the chunk may cover the end of one loop and the start of others
+        for (index_type i = start; i < stop; ++k) {
+          const index_type loop_begin = k > index_type(0) ? loop_ends[k-1] : index_type(0);
+          const index_type loop_stop = std::min(stop, loop_ends[k]);
+          value_type::call(&begin[k], i - loop_begin, loop_stop - loop_begin, args...);
+          i = loop_stop;
+          if (loop_stop < loop_ends[k]) {
+            break;
+          }
+        }
+      }
+    }
+
+    return run_storage;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
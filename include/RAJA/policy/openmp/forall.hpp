@@ -25,8 +25,14 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
@@ -40,7 +46,9 @@
 
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
 
@@ -68,6 +76,36 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel policy implementation with forall parameters
+///
+/// Each thread runs its iterations on a private copy of the parameters and
+/// the copies are combined once per thread after the loop.
+///
+template <typename Iterable, typename Func, typename InnerPolicy,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                    const omp_parallel_exec<InnerPolicy>&,
+                                                    Iterable&& iter,
+                                                    Func&& loop_body,
+                                                    expt::ForallParamPack<Params...>& params)
+{
+  using pack_type = expt::ForallParamPack<Params...>;
+  expt::ThreadParams<pack_type> thread_params(params, omp_get_max_threads());
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    pack_type priv = thread_params.get_priv();
+    forall_impl(host_res, InnerPolicy{}, iter, [&](decltype(*std::begin(iter)) i) {
+      expt::invoke_body(priv, body.get_priv(), i);
+    });
+    thread_params.store(omp_get_thread_num(), priv);
+  });
+  thread_params.finalize();
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 
 ///
 /// OpenMP parallel for schedule policy implementation
@@ -308,6 +346,78 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP NUMA-affine static policy implementation
+///
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_parallel_for_numa_exec&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_type = decltype(distance_it);
+
+#if _OPENMP >= 201307
+#pragma omp parallel proc_bind(spread)
+#else
+#pragma omp parallel
+#endif
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    // the block of each thread depends only on the loop length and team
+    // size, never on the OpenMP runtime's schedule
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const diff_type lo = RAJA::detail::firstIndex(distance_it, num_threads, tid);
+    const diff_type hi = RAJA::detail::firstIndex(distance_it, num_threads, tid + 1);
+    for (diff_type i = lo; i < hi; ++i) {
+      body.get_priv()(begin_it[i]);
+    }
+  }
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP NUMA-affine static policy implementation with forall parameters
+///
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_parallel_for_numa_exec&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body,
+                                                               expt::ForallParamPack<Params...>& params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_type = decltype(distance_it);
+  using pack_type = expt::ForallParamPack<Params...>;
+  expt::ThreadParams<pack_type> thread_params(params, omp_get_max_threads());
+
+#if _OPENMP >= 201307
+#pragma omp parallel proc_bind(spread)
+#else
+#pragma omp parallel
+#endif
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    pack_type priv = thread_params.get_priv();
+
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
+    const diff_type lo = RAJA::detail::firstIndex(distance_it, num_threads, tid);
+    const diff_type hi = RAJA::detail::firstIndex(distance_it, num_threads, tid + 1);
+    for (diff_type i = lo; i < hi; ++i) {
+      expt::invoke_body(priv, body.get_priv(), begin_it[i]);
+    }
+    thread_params.store(tid, priv);
+  }
+  thread_params.finalize();
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -318,30 +428,166 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Ready segments of one thread executing a segment dependency graph.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         The owning thread pushes and pops at the back, so a segment made
+ *         ready by the segment it just executed runs next while its data is
+ *         still in cache. Other threads steal the oldest segments from the
+ *         front.
  *
  ******************************************************************************
  */
+struct TaskGraphReadyQueue {
+  std::mutex mutex;
+  std::deque<int> segments;
+};
 
-/*
- * TODO: Fix this!!!
+/*!
+ ******************************************************************************
+ *
+ * \brief  Work-stealing scheduler shared by the threads executing a segment
+ *         dependency graph.
+ *
+ *         Only segments whose dependencies are satisfied are ever queued, so
+ *         no thread waits on a particular segment. A thread that finds no
+ *         ready segment blocks until one is queued or all segments are done.
+ *
+ ******************************************************************************
  */
+class TaskGraphScheduler
+{
+public:
+  TaskGraphScheduler(int num_segments, int max_threads)
+      : m_queues(max_threads),
+        m_num_ready(0),
+        m_num_remaining(num_segments),
+        m_num_idle(0),
+        m_cycle(false)
+  {
+  }
+
+  //! Queue ready segment on the queue of thread tid
+  void push(int tid, int seg)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_queues[tid].mutex);
+      m_queues[tid].segments.push_back(seg);
+    }
+    m_num_ready.fetch_add(1);
+    if (m_num_idle.load() > 0) {
+      // lock so the wakeup can not be lost between the idle thread's
+      // check of m_num_ready and its wait
+      { std::lock_guard<std::mutex> lock(m_idle_mutex); }
+      m_idle_cv.notify_one();
+    }
+  }
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+  //! Take a ready segment from the queue of thread tid, else steal one
+  bool pop(int tid, int num_threads, int& seg)
+  {
+    {
+      TaskGraphReadyQueue& q = m_queues[tid];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (!q.segments.empty()) {
+        seg = q.segments.back();
+        q.segments.pop_back();
+        m_num_ready.fetch_sub(1);
+        return true;
+      }
+    }
+    for (int i = 1; i < num_threads; ++i) {
+      TaskGraphReadyQueue& q = m_queues[(tid + i) % num_threads];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (!q.segments.empty()) {
+        seg = q.segments.front();
+        q.segments.pop_front();
+        m_num_ready.fetch_sub(1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Record that a segment has been executed
+  void complete()
+  {
+    if (m_num_remaining.fetch_sub(1) == 1) {
+      std::lock_guard<std::mutex> lock(m_idle_mutex);
+      m_idle_cv.notify_all();
+    }
+  }
+
+  ///
+  /// Block until a segment is ready or no segment remains to be executed.
+  ///
+  /// Returns false when the calling thread should stop.
+  ///
+  bool wait(int num_threads)
+  {
+    std::unique_lock<std::mutex> lock(m_idle_mutex);
+    m_num_idle.fetch_add(1);
+    while (m_num_ready.load() <= 0 && m_num_remaining.load() > 0 &&
+           !m_cycle) {
+      if (m_num_idle.load() == num_threads) {
+        // every thread is idle, so no segment can ever become ready
+        m_cycle = true;
+        m_idle_cv.notify_all();
+      } else {
+        m_idle_cv.wait(lock);
+      }
+    }
+    m_num_idle.fetch_sub(1);
+    return m_num_remaining.load() > 0 && !m_cycle;
+  }
+
+  //! Returns true if segments could not run due to a dependency cycle
+  bool cycle() const { return m_cycle; }
+
+private:
+  std::vector<TaskGraphReadyQueue> m_queues;
+  std::atomic<int> m_num_ready;
+  std::atomic<int> m_num_remaining;
+  std::atomic<int> m_num_idle;
+  std::mutex m_idle_mutex;
+  std::condition_variable m_idle_cv;
+  bool m_cycle;
+};
+
+}  // end namespace internal
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in an omp parallel region ordered
+ *         by the segment dependency graph. Individual segment execution will
+ *         use the segment execution policy of the index set policy.
+ *
+ *         Segments with no dependencies are dealt round-robin to the
+ *         threads. After executing a segment a thread satisfies one
+ *         dependency of each of its forward-dependencies and queues those
+ *         that become ready on its own queue; idle threads steal queued
+ *         segments from other threads.
+ *
+ *         Each node is reset after its segment executes, so the graph can
+ *         be executed again, e.g., once per timestep.
+ *
+ *         This method assumes that a task dependency graph has been
+ *         properly set up for each segment in the index set.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host host_res,
+    const omp_taskgraph_segit&,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    Func&& seg_body)
 {
   if (!iset.dependencyGraphSet()) {
     std::cerr << "\n RAJA IndexSet dependency graph not set , "
@@ -349,36 +595,135 @@ RAJA_INLINE void forall(
     RAJA_ABORT_OR_THROW("IndexSet dependency graph");
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  using iset_type = TypedIndexSet<SegmentTypes...>;
+  iset_type& ncis = (*const_cast<iset_type*>(&iset));
 
-  int num_seg = ncis.getNumSegments();
+  const int num_seg = ncis.getNumSegments();
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+  internal::TaskGraphScheduler sched(num_seg, omp_get_max_threads());
 
-    task->wait();
+#pragma omp parallel
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(seg_body);
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+    const int tid = omp_get_thread_num();
+    const int num_threads = omp_get_num_threads();
 
-    task->reset();
+    for (int isi = tid; isi < num_seg; isi += num_threads) {
+      if (ncis.getDepGraphNode(isi)->semaphoreReloadValue() == 0) {
+        sched.push(tid, isi);
+      }
+    }
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
+    int seg;
+    do {
+      while (sched.pop(tid, num_threads, seg)) {
+        DepGraphNode* task = ncis.getDepGraphNode(seg);
+
+        body.get_priv()(seg);
+
+        task->reset();
+
+        for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+          int dep_seg = task->depTaskNum(ii);
+          if (ncis.getDepGraphNode(dep_seg)->satisfyOne()) {
+            sched.push(tid, dep_seg);
+          }
+        }
+
+        sched.complete();
+      }
+    } while (sched.wait(num_threads));
+  }
+
+  if (sched.cycle()) {
+    ncis.resetDependencyGraph();
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph has a cycle");
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over the iterations of all index set segments in one omp
+ *         parallel region, giving each thread an equal share of the total
+ *         iteration count regardless of segment boundaries.
+ *
+ *         Each thread finds the segment holding the first iteration of its
+ *         share from the segment starting icounts and runs the part of
+ *         each segment in its share with the segment execution policy, so
+ *         an index set mixing many short segments and a few long ones is
+ *         balanced without a barrier per segment.
+ *
+ ******************************************************************************
+ */
+template <typename Res,
+          typename SegmentExecPolicy,
+          typename SegmentCall,
+          typename Func,
+          typename... SegmentTypes>
+RAJA_INLINE resources::EventProxy<Res> forall_impl(
+    Res r,
+    const omp_parallel_flatten_segit&,
+    SegmentExecPolicy,
+    const TypedIndexSet<SegmentTypes...>& iset,
+    SegmentCall call,
+    Func&& loop_body)
+{
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  const Index_type len = static_cast<Index_type>(iset.getLength());
+
+  if (len == 0) {
+    return resources::EventProxy<Res>(r);
+  }
+
+#pragma omp parallel
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    const Index_type tid = omp_get_thread_num();
+    const Index_type num_threads = omp_get_num_threads();
+
+    Index_type pos = (len * tid) / num_threads;
+    const Index_type last = (len * (tid + 1)) / num_threads;
+
+    // last segment starting at or before pos
+    int seg = 0;
+    int seg_hi = num_seg;
+    while (seg_hi - seg > 1) {
+      const int mid = seg + (seg_hi - seg) / 2;
+      if (iset.getStartingIcount(mid) <= pos) {
+        seg = mid;
+      } else {
+        seg_hi = mid;
       }
     }
 
-  }  // iterate over segments of index set
+    for (; pos < last; ++seg) {
+      const Index_type seg_begin = iset.getStartingIcount(seg);
+      const Index_type seg_end =
+          (seg + 1 < num_seg) ? iset.getStartingIcount(seg + 1) : len;
+      const Index_type end = std::min(last, seg_end);
+      if (end > pos) {
+        iset.segmentCall(seg,
+                         call,
+                         seg_begin,
+                         pos - seg_begin,
+                         end - pos,
+                         SegmentExecPolicy(),
+                         body.get_priv(),
+                         r);
+        pos = end;
+      }
+    }
+  }
+
+  return resources::EventProxy<Res>(r);
 }
-*/
 
 }  // namespace omp
 
@@ -0,0 +1,135 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the OpenMP dataflow executor of
+ *          statement::TiledHyperplane.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_TiledHyperplane_HPP
+#define RAJA_policy_openmp_kernel_TiledHyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/region.hpp"
+
+#include "RAJA/pattern/kernel/TiledHyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+template <camp::idx_t... Args,
+          typename TilePolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::TiledHyperplane<ArgList<Args...>,
+                                                    TilePolicy,
+                                                    omp_hyperplane_dataflow_exec,
+                                                    EnclosedStmts...>,
+                         Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    static_assert(TiledHyperplaneTileSizes<TilePolicy>::valid_for(
+                      sizeof...(Args)),
+                  "TiledHyperplane needs one tile size per argument");
+
+    static constexpr camp::idx_t num_args = sizeof...(Args);
+
+    using data_t = camp::decay<Data>;
+
+    // Set the argument types for the tile loops
+    using NewTypes =
+        typename TiledHyperplaneTypes<Types, data_t, Args...>::type;
+
+    auto schedule = make_tiled_hyperplane_schedule<TilePolicy, Args...>(data);
+    const camp::idx_t num_tiles = schedule.tiles.size();
+    if (num_tiles == 0) {
+      return;
+    }
+
+    // number of unfinished tiles each tile depends on, by tile number
+    std::unique_ptr<std::atomic<int>[]> pending(
+        new std::atomic<int>[num_tiles]);
+    for (camp::idx_t t = 0; t < num_tiles; ++t) {
+      camp::idx_t coords[num_args];
+      schedule.get_coords(t, coords);
+      int count = 0;
+      for (camp::idx_t d = 0; d < num_args; ++d) {
+        count += coords[d] > 0 ? 1 : 0;
+      }
+      pending[t].store(count, std::memory_order_relaxed);
+    }
+
+    std::atomic<camp::idx_t> next_tile{0};
+
+    TiledHyperplaneWrapper<ArgList<Args...>, data_t, NewTypes, EnclosedStmts...>
+        tile_wrapper(data, &schedule);
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(tile_wrapper);
+      auto& body = privatizer.get_priv();
+
+      // Tiles are handed out in tile hyperplane order, so the tiles a tile
+      // depends on were handed out before it and are running or finished.
+      for (camp::idx_t k = next_tile.fetch_add(1, std::memory_order_relaxed);
+           k < num_tiles;
+           k = next_tile.fetch_add(1, std::memory_order_relaxed)) {
+
+        const camp::idx_t tile = schedule.tiles[k];
+        while (pending[tile].load(std::memory_order_acquire) > 0) {
+          std::this_thread::yield();
+        }
+
+        body(k);
+
+        camp::idx_t coords[num_args];
+        schedule.get_coords(tile, coords);
+        camp::idx_t stride = 1;
+        for (camp::idx_t d = num_args - 1; d >= 0; --d) {
+          if (coords[d] + 1 < schedule.num_tiles[d]) {
+            pending[tile + stride].fetch_sub(1, std::memory_order_release);
+          }
+          stride *= schedule.num_tiles[d];
+        }
+      }
+    });
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
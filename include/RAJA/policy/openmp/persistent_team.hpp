@@ -0,0 +1,329 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent OpenMP thread team and the
+ *          RAJA forall and region implementations that run on it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_persistent_team_openmp_HPP
+#define RAJA_persistent_team_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/region.hpp"
+
+namespace RAJA
+{
+
+namespace omp
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Team of OpenMP threads kept alive in one parallel region between
+ *         the bodies it executes.
+ *
+ *         The region is opened once on a helper thread. Between bodies the
+ *         team threads wait at a barrier that spins for a while and then
+ *         sleeps, so back-to-back loops pay for a wake-up instead of a
+ *         fork and join each. Bodies run in the team's parallel region, so
+ *         OpenMP worksharing constructs, thread numbers and the OpenMP
+ *         reductions work in them as in an 'omp parallel' region.
+ *
+ *         The calling thread waits for the team and does not take part in
+ *         the body. Calls from several threads are serialized, and a call
+ *         from a team thread runs the body in a nested region of one
+ *         thread.
+ *
+ ******************************************************************************
+ */
+class PersistentTeam
+{
+public:
+  //! Number of checks a waiting thread spins for before it sleeps
+  static constexpr int default_spin_count = 1 << 12;
+
+  //! Number of the first checks that pause the core instead of yielding it
+  static constexpr int pause_count = 256;
+
+  //! Default team with omp_get_max_threads() threads, created on first use
+  static PersistentTeam& get_default()
+  {
+    // never destroyed so the team outlives static objects that use it
+    static PersistentTeam* team = new PersistentTeam();
+    return *team;
+  }
+
+  //! Start a team of num_threads threads
+  explicit PersistentTeam(int num_threads = omp_get_max_threads(),
+                          int spin_count = default_spin_count)
+      : m_size(0),
+        m_spin_count(spin_count),
+        m_fn(nullptr),
+        m_arg(nullptr),
+        m_generation(0),
+        m_pending(0),
+        m_num_sleeping(0)
+  {
+    const int requested = num_threads < 1 ? 1 : num_threads;
+    m_thread = std::thread([this, requested]() {
+#pragma omp parallel num_threads(requested)
+      {
+        if (omp_get_thread_num() == 0) {
+          m_size.store(omp_get_num_threads());
+          wake();
+        }
+        worker();
+      }
+    });
+    wait_for([this]() { return m_size.load() != 0; });
+  }
+
+  PersistentTeam(const PersistentTeam&) = delete;
+  PersistentTeam& operator=(const PersistentTeam&) = delete;
+
+  //! Release the team threads and end the parallel region
+  ~PersistentTeam()
+  {
+    dispatch(nullptr, nullptr);
+    m_thread.join();
+  }
+
+  //! Number of threads in the team
+  int size() const { return m_size.load(); }
+
+  //! Call body() on every team thread and wait until all have returned
+  template <typename Body>
+  void run(Body&& body)
+  {
+    using body_type = typename std::decay<Body>::type;
+    if (in_team()) {
+#pragma omp parallel num_threads(1)
+      {
+        body();
+      }
+      return;
+    }
+    const body_type& body_ref = body;
+    dispatch(&call<body_type>, static_cast<const void*>(&body_ref));
+  }
+
+private:
+  using task_fn = void (*)(const void*);
+
+  template <typename Body>
+  static void call(const void* body)
+  {
+    (*static_cast<const Body*>(body))();
+  }
+
+  static bool& in_team()
+  {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  static void cpu_relax()
+  {
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+    __builtin_ia32_pause();
+#endif
+  }
+
+  ///
+  /// Wait until pred() is true, spinning first and then sleeping until
+  /// woken by wake().
+  ///
+  /// The spin yields the core after a short while so a thread sharing it,
+  /// such as the caller waiting on the team, does not hold up the thread
+  /// it waits for.
+  ///
+  template <typename Pred>
+  void wait_for(Pred pred)
+  {
+    for (int i = 0; i < m_spin_count; ++i) {
+      if (pred()) {
+        return;
+      }
+      if (i < pause_count) {
+        cpu_relax();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_num_sleeping.fetch_add(1);
+    m_cv.wait(lock, pred);
+    m_num_sleeping.fetch_sub(1);
+  }
+
+  //! Wake sleeping threads after changing a waited on condition
+  void wake()
+  {
+    if (m_num_sleeping.load() > 0) {
+      // lock so the wakeup can not be lost between a sleeping thread's
+      // check of its condition and its wait
+      { std::lock_guard<std::mutex> lock(m_mutex); }
+      m_cv.notify_all();
+    }
+  }
+
+  //! Run fn(arg) on every team thread, a null fn ends the team
+  void dispatch(task_fn fn, const void* arg)
+  {
+    std::lock_guard<std::mutex> lock(m_run_mutex);
+    m_fn = fn;
+    m_arg = arg;
+    m_pending.store(fn ? m_size.load() : 0);
+    m_generation.fetch_add(1);
+    wake();
+    wait_for([this]() { return m_pending.load() == 0; });
+  }
+
+  //! Loop of each team thread, executing the dispatched bodies
+  void worker()
+  {
+    in_team() = true;
+    unsigned generation = 0;
+    while (true) {
+      wait_for([this, generation]() {
+        return m_generation.load() != generation;
+      });
+      ++generation;
+
+      task_fn fn = m_fn;
+      if (fn == nullptr) {
+        break;
+      }
+      fn(m_arg);
+
+      if (m_pending.fetch_sub(1) == 1) {
+        wake();
+      }
+    }
+  }
+
+  std::thread m_thread;
+  std::atomic<int> m_size;
+  int m_spin_count;
+
+  task_fn m_fn;
+  const void* m_arg;
+  std::atomic<unsigned> m_generation;
+  std::atomic<int> m_pending;
+
+  std::atomic<int> m_num_sleeping;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+
+  std::mutex m_run_mutex;
+};
+
+}  // namespace omp
+
+namespace policy
+{
+namespace omp
+{
+
+/*!
+ * \brief RAJA::region implementation for the persistent OpenMP team.
+ *
+ * Runs the body on every thread of RAJA::omp::PersistentTeam::get_default()
+ * like an 'omp parallel' region, so the loops in it can use omp_for_exec
+ * and the other inner OpenMP loop policies.
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_persistent_region &, Func &&body)
+{
+  ::RAJA::omp::PersistentTeam::get_default().run([&]() {
+    // thread private copy of body
+    auto loopbody = body;
+    loopbody();
+  });
+}
+
+///
+/// OpenMP persistent team policy implementation
+///
+template <typename Iterable, typename Func, typename InnerPolicy>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                    const omp_persistent_exec<InnerPolicy>&,
+                                                    Iterable&& iter,
+                                                    Func&& loop_body)
+{
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_impl(host_res, InnerPolicy{}, iter, body.get_priv());
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP persistent team policy implementation with forall parameters
+///
+template <typename Iterable, typename Func, typename InnerPolicy,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                    const omp_persistent_exec<InnerPolicy>&,
+                                                    Iterable&& iter,
+                                                    Func&& loop_body,
+                                                    expt::ForallParamPack<Params...>& params)
+{
+  using pack_type = expt::ForallParamPack<Params...>;
+  expt::ThreadParams<pack_type> thread_params(
+      params, ::RAJA::omp::PersistentTeam::get_default().size());
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    pack_type priv = thread_params.get_priv();
+    forall_impl(host_res, InnerPolicy{}, iter, [&](decltype(*std::begin(iter)) i) {
+      expt::invoke_body(priv, body.get_priv(), i);
+    });
+    thread_params.store(omp_get_thread_num(), priv);
+  });
+  thread_params.finalize();
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace omp
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
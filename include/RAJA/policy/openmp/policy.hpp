@@ -56,6 +56,14 @@ namespace internal
         constexpr static omp_sched_t schedule = Sched;
         constexpr static int chunk_size = Chunk;
     };
+
+    struct ScanAlgorithmTag {};
+
+    template <int BlockBytes>
+    struct ScanAlgorithm : public ScanAlgorithmTag {
+        static_assert(BlockBytes > 0, "Scan block size must be positive");
+        constexpr static int block_bytes = BlockBytes;
+    };
 }  // namespace internal
 
 //
@@ -75,6 +83,12 @@ struct For {
 struct NoWait {
 };
 
+struct Persistent {
+};
+
+struct NumaStatic {
+};
+
 static constexpr int default_chunk_size = -1;
 
 struct Auto : private internal::Schedule<omp_sched_auto, default_chunk_size>{
@@ -93,6 +107,28 @@ using Guided = internal::Schedule<omp_sched_guided, ChunkSize>;
 struct Runtime : private internal::Schedule<static_cast<omp_sched_t>(-1), default_chunk_size> {
 };
 
+//
+// Scan algorithm tags, BlockBytes is the size in bytes of the blocks of
+// the sequence each thread works on at a time and should fit in cache.
+//
+static constexpr int default_scan_block_bytes = 1 << 15;
+
+///
+///  Each round every thread reduces one block, the block sums are scanned,
+///  then every thread scans its block while it is still in cache.
+///
+template <int BlockBytes = default_scan_block_bytes>
+struct ReduceThenScan : public internal::ScanAlgorithm<BlockBytes> {
+};
+
+///
+///  Single pass scan, threads claim blocks in order and find the prefix of
+///  their block by looking back at the published results of earlier blocks.
+///
+template <int BlockBytes = default_scan_block_bytes>
+struct DecoupledLookBack : public internal::ScanAlgorithm<BlockBytes> {
+};
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -111,6 +147,17 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+///  Struct supporting a parallel region on the persistent OpenMP thread
+///  team RAJA::omp::PersistentTeam::get_default().
+///
+struct omp_persistent_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 ///  Struct supporting OpenMP parallel region for Teams
 ///
@@ -121,6 +168,21 @@ struct omp_launch_t
                                             Platform::host> {
 };
 
+///
+///  Struct supporting OpenMP parallel region for Teams in which the threads
+///  are split into host teams of TEAM_SIZE threads, each with its own team
+///  shared memory and team barrier
+///
+template <int TEAM_SIZE = 1>
+struct omp_team_launch_t
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(TEAM_SIZE > 0, "omp_team_launch_t needs a positive TEAM_SIZE");
+  static constexpr int team_size = TEAM_SIZE;
+};
+
 
 ///
 ///  Struct supporting OpenMP 'for nowait schedule( )'
@@ -223,6 +285,90 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+///  Struct supporting NUMA-affine static execution. Each loop is split into
+///  one contiguous block of iterations per thread, in thread order, inside
+///  an 'omp parallel proc_bind(spread)' region. Loops of the same length
+///  give each thread the same iterations in every forall and kernel call,
+///  and RAJA::first_touch with this policy places pages on the NUMA node of
+///  the thread that uses them.
+///
+struct omp_parallel_for_numa_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                                          Pattern::forall,
+                                                                          Launch::undefined,
+                                                                          Platform::host,
+                                                                          omp::Parallel,
+                                                                          omp::NumaStatic> {
+};
+
+///
+///  Struct supporting execution of an inner loop execution construct on
+///  the persistent OpenMP thread team; i.e., the team is woken from its
+///  barrier instead of opening a new 'omp parallel' region.
+///
+template <typename InnerPolicy>
+using omp_persistent_exec = make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Persistent,
+                                            wrapper<InnerPolicy>>;
+
+///
+///  Internal type aliases supporting 'omp for schedule( )' on the
+///  persistent team for specific schedule types. Static schedules use
+///  'nowait' since the team joins when the loop is done.
+///
+using omp_persistent_for_exec = omp_persistent_exec<omp_for_nowait_static_exec<>>;
+
+///
+template <int ChunkSize = default_chunk_size>
+using omp_persistent_for_static_exec = omp_persistent_exec<omp_for_nowait_static_exec<ChunkSize>>;
+
+///
+template <int ChunkSize = default_chunk_size>
+using omp_persistent_for_dynamic_exec = omp_persistent_exec<omp_for_schedule_exec<omp::Dynamic<ChunkSize>>>;
+
+///
+template <int ChunkSize = default_chunk_size>
+using omp_persistent_for_guided_exec = omp_persistent_exec<omp_for_schedule_exec<omp::Guided<ChunkSize>>>;
+
+///
+///  Struct supporting scans in an OpenMP parallel region using the
+///  given scan algorithm. Only valid for the scan algorithms.
+///
+template <typename ScanAlgorithm>
+struct omp_parallel_scan_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                                      Pattern::forall,
+                                                                      Launch::undefined,
+                                                                      Platform::host,
+                                                                      omp::Parallel,
+                                                                      ScanAlgorithm> {
+  static_assert(std::is_base_of<internal::ScanAlgorithmTag, ScanAlgorithm>::value,
+                "ScanAlgorithm must be one of omp::ReduceThenScan or omp::DecoupledLookBack");
+};
+
+///
+template <int BlockBytes = default_scan_block_bytes>
+using omp_parallel_reduce_then_scan_exec = omp_parallel_scan_exec<omp::ReduceThenScan<BlockBytes>>;
+
+///
+template <int BlockBytes = default_scan_block_bytes>
+using omp_parallel_lookback_scan_exec = omp_parallel_scan_exec<omp::DecoupledLookBack<BlockBytes>>;
+
+///
+/// Tile execution policy for statement::TiledHyperplane that runs the tiles
+/// in an OpenMP parallel region with point-to-point synchronization.
+///
+/// Each tile has a counter of the tiles it depends on that have not finished.
+/// Threads take tiles in tile hyperplane order, wait for the counter of their
+/// tile to reach zero, run it, and decrement the counters of the tiles that
+/// depend on it, so no thread waits at a barrier between tile hyperplanes.
+///
+struct omp_hyperplane_dataflow_exec
+    : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::For> {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -236,6 +382,17 @@ using omp_parallel_for_segit = omp_parallel_for_exec;
 ///
 using omp_parallel_segit = omp_parallel_for_segit;
 
+///
+/// Segment iteration policy that splits the total number of iterations of
+/// an index set evenly across the threads of one OpenMP parallel region,
+/// regardless of segment boundaries. Each thread runs the parts of the
+/// segments in its share with the segment execution policy.
+///
+struct omp_parallel_flatten_segit
+    : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::Parallel>,
+      RAJA::policy::indexset::flatten_segit_base {
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -267,6 +424,31 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+/// WorkGroup order policies that run all the loops of a group in one
+/// parallel region
+///
+
+///
+/// Runs the loops in the order they were enqueued, each divided statically
+/// among the threads, with a barrier between loops
+///
+struct ordered_omp_single_region
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
+///
+/// Runs the loops in any order; threads claim chunks of the iteration space
+/// of all the loops joined end to end, without barriers between loops
+///
+struct unordered_omp_flattened_chunks
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -282,6 +464,11 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+struct omp_reduce_padded
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -328,6 +515,24 @@ using policy::omp::omp_parallel_for_dynamic_exec;
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+///
+using policy::omp::omp_parallel_for_numa_exec;
+///
+using policy::omp::omp_persistent_for_exec;
+///
+using policy::omp::omp_persistent_for_static_exec;
+///
+using policy::omp::omp_persistent_for_dynamic_exec;
+///
+using policy::omp::omp_persistent_for_guided_exec;
+///
+using policy::omp::omp_parallel_scan_exec;
+///
+using policy::omp::omp_parallel_reduce_then_scan_exec;
+///
+using policy::omp::omp_parallel_lookback_scan_exec;
+///
+using policy::omp::omp_hyperplane_dataflow_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -335,6 +540,7 @@ using policy::omp::omp_parallel_for_runtime_exec;
 using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
+using policy::omp::omp_parallel_flatten_segit;
 
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
@@ -342,6 +548,12 @@ using policy::omp::omp_parallel_segit;
 ///
 using policy::omp::omp_parallel_exec;
 
+///
+/// Type alias for the persistent team containing an inner 'omp for' loop
+/// execution policy.
+///
+using policy::omp::omp_persistent_exec;
+
 ///
 /// Type alias for 'omp for' loop execution within an omp_parallel_exec construct
 ///
@@ -380,10 +592,13 @@ using policy::omp::omp_for_runtime_exec;
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
+///
+using policy::omp::omp_persistent_region;
 
 namespace expt
 {
   using policy::omp::omp_launch_t;
+  using policy::omp::omp_team_launch_t;
 }
 
 ///
@@ -392,6 +607,8 @@ namespace expt
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+///
+using policy::omp::omp_reduce_padded;
 
 ///
 /// Type aliases for omp reductions
@@ -400,6 +617,8 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+using policy::omp::ordered_omp_single_region;
+using policy::omp::unordered_omp_flattened_chunks;
 
 }  // namespace RAJA
 
@@ -26,10 +26,14 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <memory>
+#include <new>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -124,6 +128,156 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Padded reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/*!
+ * \brief Per-thread storage for ReduceOMPPadded.
+ *
+ * Each thread owns one slot. The slots are cache line aligned and padded
+ * to whole cache lines, so thread-private copies combine into their slot
+ * without locking and without false sharing. One extra slot collects
+ * values from threads that have no slot of their own. All slots are
+ * combined with a pairwise tree when the value is requested.
+ */
+template <typename T>
+class OMPPaddedSlots
+{
+  static constexpr size_t cache_line = RAJA::DATA_ALIGN < 64
+                                           ? 64 : RAJA::DATA_ALIGN;
+
+  static_assert(alignof(T) <= cache_line,
+                "OMPPaddedSlots value type alignment exceeds a cache line");
+
+public:
+  //! bytes in one slot, sizeof(T) rounded up to whole cache lines
+  static constexpr size_t slot_bytes =
+      (sizeof(T) + cache_line - 1) / cache_line * cache_line;
+
+  OMPPaddedSlots(int num_threads, T const& identity)
+      : m_num_threads(num_threads < 1 ? 1 : num_threads),
+        m_data(RAJA::allocate_aligned_type<char>(
+            cache_line, (m_num_threads + 1) * slot_bytes))
+  {
+    if (m_data == nullptr) {
+      RAJA_ABORT_OR_THROW("OMPPaddedSlots memory allocation failed");
+    }
+    for (int i = 0; i <= m_num_threads; ++i) {
+      new (m_data + i * slot_bytes) T(identity);
+    }
+  }
+
+  OMPPaddedSlots(OMPPaddedSlots const&) = delete;
+  OMPPaddedSlots& operator=(OMPPaddedSlots const&) = delete;
+
+  ~OMPPaddedSlots()
+  {
+    for (int i = m_num_threads; i >= 0; --i) {
+      (*this)[i].~T();
+    }
+    RAJA::free_aligned(m_data);
+  }
+
+  //! number of thread-owned slots
+  int size() const { return m_num_threads; }
+
+  T& operator[](int slot)
+  {
+    return *reinterpret_cast<T*>(m_data + slot * slot_bytes);
+  }
+
+  //! shared slot for threads without their own, must be updated under a lock
+  T& overflow() { return (*this)[m_num_threads]; }
+
+  /*!
+   * \brief Combine all slots into slot 0 and reset the others to identity.
+   *
+   * The combination order depends only on the number of slots. The result
+   * is therefore reproducible only if each run assigns the same iterations
+   * to the same thread ids, e.g. a static schedule with a fixed number of
+   * threads, and no values go to the overflow slot.
+   */
+  template <typename Reduce>
+  T& combine(T const& identity)
+  {
+    const int num_slots = m_num_threads + 1;
+    for (int width = 1; width < num_slots; width *= 2) {
+      for (int i = 0; i + width < num_slots; i += 2 * width) {
+        Reduce{}((*this)[i], (*this)[i + width]);
+        (*this)[i + width] = identity;
+      }
+    }
+    return (*this)[0];
+  }
+
+private:
+  int m_num_threads;
+  char* m_data;
+};
+
+template <typename T, typename Reduce>
+class ReduceOMPPadded
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPPadded<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPPadded>;
+  std::shared_ptr<OMPPaddedSlots<T>> data;
+
+public:
+  ReduceOMPPadded() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPPadded(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    data = std::make_shared<OMPPaddedSlots<T>>(omp_get_max_threads(),
+                                               identity_);
+  }
+
+  ~ReduceOMPPadded()
+  {
+    combine_local();
+  }
+
+  T get_combined() const
+  {
+    combine_local();
+    return data->template combine<Reduce>(Base::identity);
+  }
+
+private:
+  void combine_local() const
+  {
+    if (Base::my_data != Base::identity) {
+      int tid = omp_get_thread_num();
+      if (tid < data->size() && omp_get_active_level() <= 1) {
+        Reduce{}((*data)[tid], Base::my_data);
+      } else {
+        // more threads than omp_get_max_threads() reported at construction
+        // (e.g. a num_threads clause) or nested teams sharing thread ids
+#pragma omp critical(ompReducePaddedOverflow)
+        Reduce{}(data->overflow(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_padded, detail::ReduceOMPPadded)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
@@ -21,19 +21,224 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/policy/openmp/chunk_executor.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/segmented_scan.hpp"
 
 namespace RAJA
 {
+namespace detail
+{
+namespace openmp
+{
+
+/*!
+        \brief number of values in a block of the given scan algorithm
+*/
+template <typename Value, typename ScanAlgorithm>
+constexpr size_t scan_block_size()
+{
+  return (static_cast<size_t>(ScanAlgorithm::block_bytes) < sizeof(Value))
+             ? 1
+             : static_cast<size_t>(ScanAlgorithm::block_bytes) / sizeof(Value);
+}
+
+/*!
+        \brief reduce the values in [begin, end)
+*/
+template <typename Value, typename Iter, typename BinFn>
+RAJA_INLINE Value scan_block_reduce(Iter begin, Iter end, BinFn f)
+{
+  Value sum = BinFn::identity();
+  for (; begin != end; ++begin) {
+    sum = f(sum, *begin);
+  }
+  return sum;
+}
+
+/*!
+        \brief scan the values in [begin, end) into out starting from prefix,
+   out may be begin
+*/
+template <bool Inclusive, typename Iter, typename OutIter, typename BinFn,
+          typename Value>
+RAJA_INLINE void scan_block(Iter begin, Iter end, OutIter out, BinFn f,
+                            Value prefix)
+{
+  for (; begin != end; ++begin, ++out) {
+    if (Inclusive) {
+      prefix = f(prefix, *begin);
+      *out = prefix;
+    } else {
+      const Value val = *begin;
+      *out = prefix;
+      prefix = f(prefix, val);
+    }
+  }
+}
+
+/*!
+        \brief scan [begin, end) into out in rounds of one cache sized block
+   per thread; each round reduces the blocks, combines the block sums, and
+   scans the blocks while they are still in cache
+*/
+template <bool Inclusive, int BlockBytes, typename Iter, typename OutIter,
+          typename BinFn, typename Value>
+void scan(::RAJA::policy::omp::ReduceThenScan<BlockBytes> alg,
+          Iter begin,
+          Iter end,
+          OutIter out,
+          BinFn f,
+          Value init)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  const DistanceT block =
+      static_cast<DistanceT>(scan_block_size<Value, decltype(alg)>());
+  const DistanceT num_blocks = RAJA_DIVIDE_CEILING_INT(n, block);
+  const int p0 = static_cast<int>(
+      std::min(num_blocks, static_cast<DistanceT>(omp_get_max_threads())));
+  if (p0 <= 0) {
+    return;
+  }
+  // two sets of block sums so a round can start before the previous
+  // round has finished reading the sums
+  ::std::vector<Value> sums(2 * p0, Value());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT round_size = block * static_cast<DistanceT>(p);
+    Value carry = init;
+    int parity = 0;
+    for (DistanceT round = 0; round < n; round += round_size) {
+      Value* round_sums = sums.data() + parity * p0;
+      const DistanceT lo =
+          std::min(n, round + static_cast<DistanceT>(pid) * block);
+      const DistanceT hi = std::min(n, lo + block);
+      round_sums[pid] =
+          scan_block_reduce<Value>(begin + lo, begin + hi, f);
+#pragma omp barrier
+      // every thread folds the sums in the same order so all threads
+      // agree on the carry into the next round
+      Value prefix = carry;
+      for (int t = 0; t < pid; ++t) {
+        prefix = f(prefix, round_sums[t]);
+      }
+      carry = prefix;
+      for (int t = pid; t < p; ++t) {
+        carry = f(carry, round_sums[t]);
+      }
+      scan_block<Inclusive>(begin + lo, begin + hi, out + lo, f, prefix);
+      parity = 1 - parity;
+    }
+  }
+}
+
+/*!
+        \brief status of a block in the decoupled look-back scan
+*/
+template <typename Value>
+struct LookBackBlock {
+  enum : int { invalid = 0, aggregate_ready = 1, prefix_ready = 2 };
+
+  LookBackBlock() : status(invalid) {}
+
+  std::atomic<int> status;
+  Value aggregate;
+  Value inclusive_prefix;
+};
+
+/*!
+        \brief single pass scan of [begin, end) into out; threads claim
+   blocks in order, publish the block reduction, and look back at earlier
+   blocks for the prefix before scanning the block while it is in cache
+*/
+template <bool Inclusive, int BlockBytes, typename Iter, typename OutIter,
+          typename BinFn, typename Value>
+void scan(::RAJA::policy::omp::DecoupledLookBack<BlockBytes> alg,
+          Iter begin,
+          Iter end,
+          OutIter out,
+          BinFn f,
+          Value init)
+{
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  using Block = LookBackBlock<Value>;
+  const DistanceT block =
+      static_cast<DistanceT>(scan_block_size<Value, decltype(alg)>());
+  const DistanceT num_blocks = RAJA_DIVIDE_CEILING_INT(n, block);
+  const int p0 = static_cast<int>(
+      std::min(num_blocks, static_cast<DistanceT>(omp_get_max_threads())));
+  if (p0 <= 0) {
+    return;
+  }
+  ::std::vector<Block> blocks(num_blocks);
+  std::atomic<DistanceT> next_block(0);
+#pragma omp parallel num_threads(p0)
+  {
+    for (DistanceT b = next_block.fetch_add(1, std::memory_order_relaxed);
+         b < num_blocks;
+         b = next_block.fetch_add(1, std::memory_order_relaxed)) {
+      const DistanceT lo = b * block;
+      const DistanceT hi = std::min(n, lo + block);
+      const Value aggregate =
+          scan_block_reduce<Value>(begin + lo, begin + hi, f);
+      Block& state = blocks[b];
+      Value prefix = init;
+      if (b != 0) {
+        state.aggregate = aggregate;
+        state.status.store(Block::aggregate_ready, std::memory_order_release);
+        // blocks are claimed in order so every earlier block is owned by a
+        // thread that will publish its aggregate without waiting
+        Value lookback = BinFn::identity();
+        for (DistanceT k = b - 1;; --k) {
+          Block& pred = blocks[k];
+          int status;
+          while ((status = pred.status.load(std::memory_order_acquire)) ==
+                 Block::invalid) {
+            std::this_thread::yield();
+          }
+          if (status == Block::prefix_ready) {
+            lookback = f(pred.inclusive_prefix, lookback);
+            break;
+          }
+          lookback = f(pred.aggregate, lookback);
+        }
+        prefix = lookback;
+      }
+      state.inclusive_prefix = f(prefix, aggregate);
+      state.status.store(Block::prefix_ready, std::memory_order_release);
+      scan_block<Inclusive>(begin + lo, begin + hi, out + lo, f, prefix);
+    }
+  }
+}
+
+/*!
+        \brief executor that runs the chunks of a segmented scan in an omp
+   parallel for, one chunk per thread
+*/
+using SegmentedScanExecutor = ChunkExecutor<1024>;
+
+}  // namespace openmp
+}  // namespace detail
+
 namespace impl
 {
 namespace scan
@@ -132,6 +337,89 @@ exclusive_inplace(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value using the given OpenMP scan algorithm
+*/
+template <typename ScanAlgorithm, typename Iter, typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive_inplace(
+    resources::Host host_res,
+    const ::RAJA::policy::omp::omp_parallel_scan_exec<ScanAlgorithm>&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::openmp::scan<true>(
+      ScanAlgorithm{}, begin, end, begin, f, Value(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value using the given OpenMP scan algorithm
+*/
+template <typename ScanAlgorithm, typename Iter, typename BinFn,
+          typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive_inplace(
+    resources::Host host_res,
+    const ::RAJA::policy::omp::omp_parallel_scan_exec<ScanAlgorithm>&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::openmp::scan<false>(
+      ScanAlgorithm{}, begin, end, begin, f, Value(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value using the given OpenMP scan algorithm
+*/
+template <typename ScanAlgorithm, typename Iter, typename OutIter,
+          typename BinFn>
+RAJA_INLINE resources::EventProxy<resources::Host> inclusive(
+    resources::Host host_res,
+    const ::RAJA::policy::omp::omp_parallel_scan_exec<ScanAlgorithm>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  ::RAJA::detail::openmp::scan<true>(
+      ScanAlgorithm{}, begin, end, out, f, Value(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value using the given OpenMP scan algorithm
+*/
+template <typename ScanAlgorithm, typename Iter, typename OutIter,
+          typename BinFn, typename ValueT>
+RAJA_INLINE resources::EventProxy<resources::Host> exclusive(
+    resources::Host host_res,
+    const ::RAJA::policy::omp::omp_parallel_scan_exec<ScanAlgorithm>&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  ::RAJA::detail::openmp::scan<false>(
+      ScanAlgorithm{}, begin, end, out, f, Value(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 /*!
         \brief explicit inclusive scan given input range, output, function, and
    initial value
@@ -179,6 +467,95 @@ exclusive(
   return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<true>(::RAJA::detail::openmp::SegmentedScanExecutor{},
+                                     segments, begin, end, out, f,
+                                     ValueT(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segments,
+   output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<false>(::RAJA::detail::openmp::SegmentedScanExecutor{},
+                                      segments, begin, end, out, f,
+                                      ValueT(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduction of each segment given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_openmp_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  const size_t num_segments =
+      RAJA::detail::reduce_by_key(::RAJA::detail::openmp::SegmentedScanExecutor{},
+                                  segments, begin, end, out, f);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             num_segments);
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -23,13 +23,18 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/policy/openmp/chunk_executor.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -50,6 +55,82 @@ namespace openmp
 constexpr int get_min_iterates_per_task() { return 128; }
 
 #ifdef RAJA_ENABLE_OPENMP_TASK
+/*!
+        \brief merge ranges [i_begin, i_middle) and [i_middle, i_end)
+               by splitting the merge path into pieces run as tasks,
+               uses buf as uninitialized temporary storage
+*/
+template <typename Iter, typename Compare>
+inline void merge_task(Iter begin,
+                       RAJA::detail::IterVal<Iter>* buf,
+                       RAJA::detail::IterDiff<Iter> i_begin,
+                       RAJA::detail::IterDiff<Iter> i_middle,
+                       RAJA::detail::IterDiff<Iter> i_end,
+                       RAJA::detail::IterDiff<Iter> iterates_per_task,
+                       Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  if ( i_begin == i_middle || i_middle == i_end ||
+       !comp(begin[i_middle], begin[i_middle-1]) ) {
+    // at least one side empty or everything already in order, done
+    return;
+  }
+
+  const diff_type n = i_end - i_begin;
+  const diff_type num_pieces = (n + iterates_per_task - 1) / iterates_per_task;
+
+  // find the split of every piece before any values are moved out of
+  // the ranges the other pieces search
+  std::vector<diff_type> splits(num_pieces + 1);
+  diff_type* split = splits.data();
+
+  for (diff_type piece = 0; piece <= num_pieces; ++piece) {
+#pragma omp task firstprivate(piece)
+    {
+      split[piece] = RAJA::detail::merge_path_split(
+          begin + i_begin, i_middle - i_begin,
+          begin + i_middle, i_end - i_middle,
+          firstIndex(n, num_pieces, piece),
+          comp);
+    }
+  }
+
+#pragma omp taskwait
+
+  for (diff_type piece = 0; piece < num_pieces; ++piece) {
+#pragma omp task firstprivate(piece)
+    {
+      RAJA::detail::merge_path_piece(begin + i_begin,
+                                     begin + i_middle,
+                                     buf + i_begin,
+                                     firstIndex(n, num_pieces, piece),
+                                     firstIndex(n, num_pieces, piece + 1),
+                                     split[piece],
+                                     split[piece + 1],
+                                     comp,
+                                     RAJA::detail::MergeMoveConstruct{});
+    }
+  }
+
+#pragma omp taskwait
+
+  for (diff_type piece = 0; piece < num_pieces; ++piece) {
+#pragma omp task firstprivate(piece)
+    {
+      const diff_type k_end = i_begin + firstIndex(n, num_pieces, piece + 1);
+      for (diff_type k = i_begin + firstIndex(n, num_pieces, piece); k < k_end; ++k) {
+        begin[k] = std::move(buf[k]);
+        buf[k].~value_type();
+      }
+    }
+  }
+
+#pragma omp taskwait
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by spawning tasks
@@ -57,6 +138,7 @@ constexpr int get_min_iterates_per_task() { return 128; }
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_task(Sorter sorter,
                       Iter begin,
+                      RAJA::detail::IterVal<Iter>* buf,
                       RAJA::detail::IterDiff<Iter> i_begin,
                       RAJA::detail::IterDiff<Iter> i_end,
                       RAJA::detail::IterDiff<Iter> iterates_per_task,
@@ -74,15 +156,14 @@ inline void sort_task(Sorter sorter,
     const diff_type i_middle = i_begin + n/2;
 
 #pragma omp task
-    sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp);
+    sort_task(sorter, begin, buf, i_begin, i_middle, iterates_per_task, comp);
 
 #pragma omp task
-    sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp);
+    sort_task(sorter, begin, buf, i_middle, i_end, iterates_per_task, comp);
 
 #pragma omp taskwait
 
-    //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-    RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    merge_task(begin, buf, i_begin, i_middle, i_end, iterates_per_task, comp);
   }
 }
 
@@ -91,11 +172,19 @@ inline void sort_task(Sorter sorter,
 /*!
         \brief sort given range using sorter and comparison function
                by manually assigning work to threads
+
+        Each level of merging is shared by all threads. The threads
+        assigned to a pair of sorted ranges split the merge path of the
+        pair evenly, so every level runs in parallel. Levels alternate
+        between the input and buf to avoid copying back, buf holds
+        uninitialized storage until the first level constructs it.
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
+                                 RAJA::detail::IterVal<Iter>* buf,
+                                 RAJA::detail::IterDiff<Iter>& buf_size,
                                  Compare comp)
 {
   using RAJA::detail::firstIndex;
@@ -105,30 +194,95 @@ inline void sort_parallel_region(Sorter sorter,
 
   const diff_type thread_id = omp_get_thread_num();
 
-  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
   {
+    const diff_type i_begin = firstIndex(n, num_threads, thread_id);
     const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
 
     // this thread sorts range [i_begin, i_end)
     sorter(begin + i_begin, begin + i_end, comp);
   }
 
+  if (num_threads > 1 && thread_id == 0) {
+    // every element of buf is constructed by the first level of merging
+    buf_size = n;
+  }
+
+  // range of output positions written by this thread in the last merge
+  diff_type i_out_begin = 0;
+  diff_type i_out_end = 0;
+
+  bool in_buf = false;
+
   // hierarchically merge ranges
   for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
 
     diff_type end_offset = 2*middle_offset;
 
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+    // the threads [group_begin, group_begin + group_size) merge ranges
+    // [i_begin, i_middle) and [i_middle, i_end) together
+    const diff_type group_begin = thread_id - thread_id % end_offset;
+    const diff_type group_size = std::min(end_offset, num_threads - group_begin);
+
+    const diff_type i_begin  = firstIndex(n, num_threads, group_begin);
+    const diff_type i_middle = firstIndex(n, num_threads, std::min(group_begin + middle_offset, num_threads));
+    const diff_type i_end    = firstIndex(n, num_threads, std::min(group_begin + end_offset,    num_threads));
+
+    const diff_type len = i_end - i_begin;
+    const diff_type k_begin = firstIndex(len, group_size, thread_id - group_begin);
+    const diff_type k_end   = firstIndex(len, group_size, thread_id - group_begin + 1);
 
 #pragma omp barrier
 
-    if (thread_id % end_offset == 0) {
+    // every thread finds its splits before any thread moves values out of
+    // the ranges the others search
+    diff_type split_begin;
+    diff_type split_end;
+    if (in_buf) {
+      split_begin = RAJA::detail::merge_path_split(
+          buf + i_begin, i_middle - i_begin,
+          buf + i_middle, i_end - i_middle, k_begin, comp);
+      split_end = RAJA::detail::merge_path_split(
+          buf + i_begin, i_middle - i_begin,
+          buf + i_middle, i_end - i_middle, k_end, comp);
+    } else {
+      split_begin = RAJA::detail::merge_path_split(
+          begin + i_begin, i_middle - i_begin,
+          begin + i_middle, i_end - i_middle, k_begin, comp);
+      split_end = RAJA::detail::merge_path_split(
+          begin + i_begin, i_middle - i_begin,
+          begin + i_middle, i_end - i_middle, k_end, comp);
+    }
+
+#pragma omp barrier
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    if (in_buf) {
+      RAJA::detail::merge_path_piece(buf + i_begin, buf + i_middle,
+                                     begin + i_begin, k_begin, k_end,
+                                     split_begin, split_end, comp,
+                                     RAJA::detail::MergeMoveAssign{});
+    } else if (middle_offset == 1) {
+      RAJA::detail::merge_path_piece(begin + i_begin, begin + i_middle,
+                                     buf + i_begin, k_begin, k_end,
+                                     split_begin, split_end, comp,
+                                     RAJA::detail::MergeMoveConstruct{});
+    } else {
+      RAJA::detail::merge_path_piece(begin + i_begin, begin + i_middle,
+                                     buf + i_begin, k_begin, k_end,
+                                     split_begin, split_end, comp,
+                                     RAJA::detail::MergeMoveAssign{});
     }
+
+    in_buf = !in_buf;
+    i_out_begin = i_begin + k_begin;
+    i_out_end   = i_begin + k_end;
+  }
+
+  if (in_buf) {
+
+#pragma omp barrier
+
+    // move back the values this thread wrote in the last merge
+    std::move(buf + i_out_begin, buf + i_out_end, begin + i_out_begin);
   }
 }
 
@@ -146,6 +300,7 @@ void sort(Sorter sorter,
           Compare comp)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
 
@@ -159,6 +314,21 @@ void sort(Sorter sorter,
 
     const diff_type max_threads = omp_get_max_threads();
 
+    // Manage the lifetime of the merge buffer and objects constructed in it
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> merge_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    value_type* buf = merge_buf.get();
+
+    // check memory allocation worked
+    if (buf == nullptr) {
+      RAJA_ABORT_OR_THROW( "openmp sort temporary memory allocation failed" );
+    }
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
 
     const diff_type iterates_per_task = std::max(n/(2*max_threads), min_iterates_per_task);
@@ -168,22 +338,31 @@ void sort(Sorter sorter,
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
 #pragma omp master
     {
-      sort_task(sorter, begin, 0, n, iterates_per_task, comp);
+      sort_task(sorter, begin, buf, 0, n, iterates_per_task, comp);
     }
 
 #else
 
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
 
+    diff_type& buf_size = buf_deleter.size;
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+      sort_parallel_region(sorter, begin, n, buf, buf_size, comp);
     }
 
 #endif
   }
 }
 
+/*!
+        \brief Executor that runs the chunks of each radix sort pass
+               in an omp parallel for, one chunk per thread
+*/
+using RadixExecutor =
+    RAJA::detail::openmp::ChunkExecutor<get_min_iterates_per_task()>;
+
 } // namespace openmp
 
 } // namespace detail
@@ -201,7 +380,13 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  auto sort_comparison = [](Iter b, Iter e, Compare c) {
+    detail::openmp::sort(detail::UnstableSorter{}, b, e, c);
+  };
+
+  RAJA::detail::radix_sort_or(detail::openmp::RadixExecutor{},
+                              sort_comparison,
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -219,7 +404,13 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  auto sort_comparison = [](Iter b, Iter e, Compare c) {
+    detail::openmp::sort(detail::StableSorter{}, b, e, c);
+  };
+
+  RAJA::detail::radix_sort_or(detail::openmp::RadixExecutor{},
+                              sort_comparison,
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -238,10 +429,16 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin  = RAJA::zip(kb, vb);
+    auto end    = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(detail::openmp::RadixExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -260,10 +457,16 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin  = RAJA::zip(kb, vb);
+    auto end    = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(detail::openmp::RadixExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
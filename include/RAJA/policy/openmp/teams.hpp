@@ -18,6 +18,9 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <algorithm>
+#include <memory>
+
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -35,10 +38,16 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
+    // every thread runs the body, so each gets its own team shared memory
+    HostTeamSharedMem shared_mem(ctx.shared_mem_size, omp_get_max_threads());
+
     RAJA::region<RAJA::omp_parallel_region>([&]() {
+      LaunchContext thread_ctx(ctx);
+      thread_ctx.shared_mem_ptr = shared_mem.get(omp_get_thread_num());
+
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
+      loop_body.get_priv()(thread_ctx);
     });
   }
 
@@ -46,17 +55,203 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   static resources::EventProxy<resources::Resource>
   exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
   {
-    RAJA::region<RAJA::omp_parallel_region>([&]() {
-      using RAJA::internal::thread_privatize;
-      auto loop_body = thread_privatize(body);
-      loop_body.get_priv()(ctx);
-    });
+    exec(ctx, body);
+
+    return resources::EventProxy<resources::Resource>(res);
+  }
+
+};
+
+/*!
+ * Launch of host teams: the threads of an OpenMP parallel region are split
+ * into teams of TEAM_SIZE threads. Each team has team shared memory of
+ * shared_mem_size bytes and a team barrier used by LaunchContext::teamSync.
+ * Team loops (omp_team_loop_exec) distribute their iterations over the
+ * teams and thread loops (omp_team_thread_loop_exec) over the threads of a
+ * team.
+ */
+template <int TEAM_SIZE>
+struct LaunchExecute<RAJA::expt::omp_team_launch_t<TEAM_SIZE>> {
+
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    const int max_teams = std::max(1, omp_get_max_threads() / TEAM_SIZE);
+
+    std::unique_ptr<HostTeamBarrier[]> barriers(new HostTeamBarrier[max_teams]);
+    HostTeamSharedMem shared_mem(ctx.shared_mem_size, max_teams);
+
+#pragma omp parallel num_threads(max_teams * TEAM_SIZE)
+    {
+      // the region may have fewer threads than asked for
+      const int num_threads = omp_get_num_threads();
+      const int team_size = std::min(TEAM_SIZE, num_threads);
+      const int num_teams = std::min(max_teams, num_threads / team_size);
+      const int tid = omp_get_thread_num();
+
+      if (tid < num_teams * team_size) {
+        HostTeam team;
+        team.id = tid / team_size;
+        team.num_teams = num_teams;
+        team.rank = tid % team_size;
+        team.size = team_size;
+        team.barrier = &barriers[team.id];
+
+        LaunchContext team_ctx(ctx);
+        team_ctx.shared_mem_ptr = shared_mem.get(team.id);
+        team_ctx.host_team = &team;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+        loop_body.get_priv()(team_ctx);
+      }
+    }
+  }
+
+  template <typename BODY>
+  static resources::EventProxy<resources::Resource>
+  exec(RAJA::resources::Resource res, LaunchContext const &ctx, BODY const &body)
+  {
+    exec(ctx, body);
 
     return resources::EventProxy<resources::Resource>(res);
   }
 
 };
 
+/*!
+ * Loop policies of host teams launches. TEAM_LOOP selects a team loop, whose
+ * iterations are distributed over the teams, or a thread loop, whose
+ * iterations are distributed over the threads of a team.
+ */
+template <bool TEAM_LOOP>
+struct omp_host_team_loop_exec {
+};
+
+//! Team loop of host teams launches, like a GPU block loop
+using omp_team_loop_exec = omp_host_team_loop_exec<true>;
+
+//! Thread loop of host teams launches, like a GPU thread loop
+using omp_team_thread_loop_exec = omp_host_team_loop_exec<false>;
+
+/*!
+ * Iterations of a team or thread loop that the calling thread runs.
+ *
+ * Only the outermost team loop and the outermost thread loop are
+ * distributed, so nested loops run all of their iterations. Outside of a
+ * host teams launch every iteration runs.
+ */
+class HostTeamLoopSlice
+{
+public:
+  HostTeamLoopSlice(LaunchContext const &ctx, bool team_loop)
+  {
+    HostTeam *team = ctx.host_team;
+    if (team != nullptr) {
+      m_depth = team_loop ? &team->team_loop_depth : &team->thread_loop_depth;
+      if (*m_depth == 0) {
+        m_first = team_loop ? team->id : team->rank;
+        m_stride = team_loop ? team->num_teams : team->size;
+      }
+      ++*m_depth;
+    }
+  }
+
+  HostTeamLoopSlice(HostTeamLoopSlice const &) = delete;
+  HostTeamLoopSlice &operator=(HostTeamLoopSlice const &) = delete;
+
+  ~HostTeamLoopSlice()
+  {
+    if (m_depth != nullptr) {
+      --*m_depth;
+    }
+  }
+
+  int first() const { return m_first; }
+  int stride() const { return m_stride; }
+
+private:
+  int *m_depth{nullptr};
+  int m_first{0};
+  int m_stride{1};
+};
+
+template <bool TEAM_LOOP, typename SEGMENT>
+struct LoopExecute<omp_host_team_loop_exec<TEAM_LOOP>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    HostTeamLoopSlice slice(ctx, TEAM_LOOP);
+    for (int i = slice.first(); i < len; i += slice.stride()) {
+      body(*(segment.begin() + i));
+    }
+  }
+};
+
+template <bool TEAM_LOOP, typename SEGMENT>
+struct LoopICountExecute<omp_host_team_loop_exec<TEAM_LOOP>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    HostTeamLoopSlice slice(ctx, TEAM_LOOP);
+    for (int i = slice.first(); i < len; i += slice.stride()) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+};
+
+template <bool TEAM_LOOP, typename SEGMENT>
+struct TileExecute<omp_host_team_loop_exec<TEAM_LOOP>, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    HostTeamLoopSlice slice(ctx, TEAM_LOOP);
+    for (int i = slice.first(); i < numTiles; i += slice.stride()) {
+      body(segment.slice(i * tile_size, tile_size));
+    }
+  }
+};
+
+template <bool TEAM_LOOP, typename SEGMENT>
+struct TileICountExecute<omp_host_team_loop_exec<TEAM_LOOP>, SEGMENT> {
+
+  template <typename BODY, typename TILE_T>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const &ctx,
+      TILE_T tile_size,
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    const int numTiles = (len - 1) / tile_size + 1;
+    HostTeamLoopSlice slice(ctx, TEAM_LOOP);
+    for (int i = slice.first(); i < numTiles; i += slice.stride()) {
+      body(segment.slice(i * tile_size, tile_size), i);
+    }
+  }
+};
+
 
 template <typename SEGMENT>
 struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
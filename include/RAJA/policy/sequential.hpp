@@ -24,6 +24,7 @@
     #include "RAJA/policy/sequential/atomic.hpp"
 #endif
 
+#include "RAJA/policy/sequential/compaction.hpp"
 #include "RAJA/policy/sequential/forall.hpp"
 #include "RAJA/policy/sequential/kernel.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
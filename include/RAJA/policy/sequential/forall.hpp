@@ -32,6 +32,7 @@
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
 
 #include "RAJA/util/resource.hpp"
 
@@ -68,6 +69,28 @@ RAJA_INLINE resources::EventProxy<Resource> forall_impl(Resource res,
   return resources::EventProxy<Resource>(res);
 }
 
+///
+/// Sequential policy implementation with forall parameters
+///
+template <typename Iterable, typename Func, typename Resource,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Resource> forall_impl(
+    Resource res,
+    const seq_exec &,
+    Iterable &&iter,
+    Func &&body,
+    expt::ForallParamPack<Params...> &params)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  RAJA_NO_SIMD
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    expt::invoke_body(params, body, *(begin_it + i));
+  }
+  expt::resolve_params(params);
+  return resources::EventProxy<Resource>(res);
+}
+
 }  // namespace sequential
 
 }  // namespace policy
@@ -37,6 +37,8 @@
 
 #include "RAJA/policy/simd/policy.hpp"
 
+#include "RAJA/pattern/params/forall.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -62,6 +64,56 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// SIMD policy implementation with forall parameters
+///
+/// The iterations are dealt round robin to simd_param_lanes private copies
+/// of the parameters, so the iterations of a group of lanes are independent
+/// and may be vectorized.
+///
+constexpr int simd_param_lanes = 8;
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host host_res,
+    const simd_exec &,
+    Iterable &&iter,
+    Func &&loop_body,
+    expt::ForallParamPack<Params...> &params)
+{
+  using pack_type = expt::ForallParamPack<Params...>;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  using diff_type = decltype(distance);
+
+  pack_type lane[simd_param_lanes];
+  for (int l = 0; l < simd_param_lanes; ++l) {
+    lane[l] = params;
+    expt::init_params(lane[l]);
+  }
+
+  const diff_type num_groups = distance / simd_param_lanes;
+  for (diff_type g = 0; g < num_groups; ++g) {
+    const diff_type group_begin = g * simd_param_lanes;
+    RAJA_SIMD
+    for (int l = 0; l < simd_param_lanes; ++l) {
+      expt::invoke_body(lane[l], loop_body, *(begin + (group_begin + l)));
+    }
+  }
+  for (diff_type i = num_groups * simd_param_lanes; i < distance; ++i) {
+    expt::invoke_body(lane[i % simd_param_lanes], loop_body, *(begin + i));
+  }
+
+  for (int l = 0; l < simd_param_lanes; ++l) {
+    expt::combine_params(params, lane[l]);
+  }
+  expt::resolve_params(params);
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -22,6 +22,7 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include "RAJA/policy/tbb/compaction.hpp"
 #include "RAJA/policy/tbb/forall.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
@@ -0,0 +1,66 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the executor that runs the chunks of the
+*          chunked algorithms (scans, compaction, radix sort) for the TBB
+*          back-end.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_chunk_executor_tbb_HPP
+#define RAJA_chunk_executor_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+
+#include <tbb/tbb.h>
+
+namespace RAJA
+{
+namespace detail
+{
+namespace tbb
+{
+
+/*!
+        \brief executor that runs the chunks of a chunked algorithm with
+   tbb::parallel_for, with at least MinIteratesPerChunk iterates per chunk and
+   at most MaxChunksPerThread chunks per thread
+*/
+template <int MinIteratesPerChunk, int MaxChunksPerThread = 1>
+struct ChunkExecutor {
+  static_assert(MinIteratesPerChunk > 0 && MaxChunksPerThread > 0,
+                "ChunkExecutor needs positive chunk limits");
+
+  template <typename diff_type>
+  int num_chunks(diff_type n) const
+  {
+    const diff_type max_chunks = n / MinIteratesPerChunk;
+    const diff_type max_threads = ::tbb::this_task_arena::max_concurrency();
+    return static_cast<int>(std::max(
+        diff_type(1), std::min(max_chunks, MaxChunksPerThread * max_threads)));
+  }
+
+  template <typename Body>
+  void operator()(int num_chunks, Body body) const
+  {
+    ::tbb::parallel_for(0, num_chunks, body);
+  }
+};
+
+}  // namespace tbb
+}  // namespace detail
+}  // namespace RAJA
+
+#endif
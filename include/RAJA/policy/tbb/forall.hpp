@@ -32,6 +32,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/params/forall.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -137,6 +138,85 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// TBB parallel for policy implementations with forall parameters
+///
+
+/**
+ * @brief Run the ranges of a TBB parallel for on per thread copies of the
+ *        forall parameters
+ *
+ * Each thread keeps one copy of the parameters for all the ranges it runs,
+ * and the copies are combined once per thread after the loop.
+ */
+template <typename Iterable, typename Func, typename Partition,
+          typename... Params>
+RAJA_INLINE void forall_params_impl(Iterable&& iter,
+                                    Func&& loop_body,
+                                    expt::ForallParamPack<Params...>& params,
+                                    Partition&& partition)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  using pack_type = expt::ForallParamPack<Params...>;
+
+  pack_type identity = params;
+  expt::init_params(identity);
+  ::tbb::enumerable_thread_specific<pack_type> thread_params(identity);
+
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  partition(dist, [=, &thread_params](const brange& r) {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop_body);
+    auto body = privatizer.get_priv();
+    pack_type& priv = thread_params.local();
+    for (auto i = r.begin(); i != r.end(); ++i)
+      expt::invoke_body(priv, body, b[i]);
+  });
+
+  thread_params.combine_each(
+      [&](const pack_type& priv) { expt::combine_params(params, priv); });
+  expt::resolve_params(params);
+}
+
+template <typename Iterable, typename Func, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_dynamic& p,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body,
+                                                               expt::ForallParamPack<Params...>& params)
+{
+  using brange = ::tbb::blocked_range<size_t>;
+  const size_t grain_size = p.grain_size;
+  forall_params_impl(iter, loop_body, params,
+                     [=](size_t dist, const auto& range_body) {
+                       ::tbb::parallel_for(brange(0, dist, grain_size), range_body);
+                     });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, size_t ChunkSize, typename... Params>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_static<ChunkSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body,
+                                                               expt::ForallParamPack<Params...>& params)
+{
+  using brange = ::tbb::blocked_range<size_t>;
+  forall_params_impl(iter, loop_body, params,
+                     [](size_t dist, const auto& range_body) {
+                       ::tbb::parallel_for(brange(0, dist, ChunkSize),
+                                           range_body,
+                                           tbb_static_partitioner{});
+                     });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
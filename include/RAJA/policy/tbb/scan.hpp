@@ -28,7 +28,10 @@
 
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/resource.hpp"
+#include "RAJA/util/segmented_scan.hpp"
 
+#include "RAJA/policy/tbb/chunk_executor.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -98,6 +101,12 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
     }
   }
 };
+
+/*!
+        \brief executor that runs the chunks of a segmented scan with
+   tbb::parallel_for
+*/
+using SegmentedScanExecutor = RAJA::detail::tbb::ChunkExecutor<4096>;
 }  // namespace detail
 
 /*!
@@ -216,6 +225,95 @@ exclusive(
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<true>(detail::SegmentedScanExecutor{},
+                                     segments, begin, end, out, f,
+                                     ValueT(BinFn::identity()));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segments,
+   output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using ValueT = RAJA::detail::IterVal<OutIter>;
+  RAJA::detail::segmented_scan<false>(detail::SegmentedScanExecutor{},
+                                      segments, begin, end, out, f,
+                                      ValueT(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit reduction of each segment given input range, segments,
+   output, and function
+*/
+template <typename ExecPolicy,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::ValueEventProxy<resources::Host, size_t>,
+                      type_traits::is_tbb_policy<ExecPolicy>>
+reduce_by_key(
+    resources::Host host_res,
+    const ExecPolicy&,
+    const Segments& segments,
+    const Iter begin,
+    const Iter end,
+    OutIter out,
+    BinFn f)
+{
+  const size_t num_segments =
+      RAJA::detail::reduce_by_key(detail::SegmentedScanExecutor{},
+                                  segments, begin, end, out, f);
+
+  return resources::ValueEventProxy<resources::Host, size_t>(host_res,
+                                                             num_segments);
+}
+
 }  // namespace scan
 
 }  // namespace impl
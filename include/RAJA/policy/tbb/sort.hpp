@@ -30,6 +30,7 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/policy/tbb/chunk_executor.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -129,6 +130,15 @@ void tbb_sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief Executor that runs the chunks of each radix sort pass
+               with tbb::parallel_for
+*/
+// every chunk adds a row of radix digit counts that each pass scans
+// serially, 16 iterates per count keep that scan at 1/16 of the pass
+using TbbRadixExecutor = RAJA::detail::tbb::ChunkExecutor<
+    16 * (1 << RAJA::detail::radix_sort_digit_bits::get()), 4>;
+
 } // namespace detail
 
 /*!
@@ -144,7 +154,13 @@ unstable(
     Iter end,
     Compare comp)
 {
-  tbb::parallel_sort(begin, end, comp);
+  auto sort_comparison = [](Iter b, Iter e, Compare c) {
+    tbb::parallel_sort(b, e, c);
+  };
+
+  RAJA::detail::radix_sort_or(detail::TbbRadixExecutor{},
+                              sort_comparison,
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -162,7 +178,13 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
+  auto sort_comparison = [](Iter b, Iter e, Compare c) {
+    detail::tbb_sort(detail::StableSorter{}, b, e, c);
+  };
+
+  RAJA::detail::radix_sort_or(detail::TbbRadixExecutor{},
+                              sort_comparison,
+                              begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -181,10 +203,16 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin  = RAJA::zip(kb, vb);
+    auto end    = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(detail::TbbRadixExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -203,10 +231,16 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  auto sort_zipped = [](KeyIter kb, KeyIter ke, ValIter vb, Compare c) {
+    auto begin  = RAJA::zip(kb, vb);
+    auto end    = RAJA::zip(ke, vb+(ke-kb));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(c));
+  };
+
+  RAJA::detail::radix_sort_pairs_or(detail::TbbRadixExecutor{},
+                                    sort_zipped,
+                                    keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
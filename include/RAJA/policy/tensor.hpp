@@ -21,6 +21,7 @@
 #define RAJA_policy_tensor_HPP
 
 #include "RAJA/policy/tensor/arch_impl.hpp"
+#include "RAJA/policy/tensor/dispatch.hpp"
 #include "RAJA/policy/tensor/policy.hpp"
 
 #endif  // closing endif for header file include guard
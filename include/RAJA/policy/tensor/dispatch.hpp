@@ -0,0 +1,242 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for runtime dispatch of tensor register kernels
+ *          compiled once for each CPU register ISA.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tensor_dispatch_HPP
+#define RAJA_policy_tensor_dispatch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <initializer_list>
+#include <utility>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief CPU register ISAs a dispatched kernel can be compiled for, ordered
+ *        from narrowest to widest.
+ */
+enum class register_isa : int { scalar = 0, avx = 1, avx2 = 2, avx512 = 3 };
+
+constexpr int num_register_isas = 4;
+
+/*!
+ * \brief Widest register ISA of the translation unit being compiled, which
+ *        is the ISA of its default_register.
+ */
+#if defined(__AVX512F__)
+constexpr register_isa compiled_register_isa = register_isa::avx512;
+#elif defined(__AVX2__)
+constexpr register_isa compiled_register_isa = register_isa::avx2;
+#elif defined(__AVX__)
+constexpr register_isa compiled_register_isa = register_isa::avx;
+#else
+constexpr register_isa compiled_register_isa = register_isa::scalar;
+#endif
+
+/*!
+ * \brief Widest register ISA the CPU and OS support.
+ *
+ * The CPU is queried with cpuid the first time this is called. The
+ * RAJA_REGISTER_ISA environment variable (scalar, avx, avx2 or avx512)
+ * lowers the result, e.g. to compare the variants of a kernel; it never
+ * raises it above what the CPU supports.
+ */
+RAJASHAREDDLL_API register_isa get_cpu_register_isa();
+
+RAJASHAREDDLL_API const char* get_register_isa_name(register_isa isa);
+
+/*!
+ * \brief Function type alias, used to declare a function from its type.
+ */
+template <typename Signature>
+using dispatch_signature = Signature;
+
+/*!
+ * \brief Table of the variants of a kernel compiled for different register
+ *        ISAs, which calls the widest variant the CPU supports.
+ *
+ * The variant is selected when the table is constructed, so a call costs
+ * one indirect function call per launch and nothing per iteration.
+ * Tables are normally created with RAJA_DEFINE_REGISTER_DISPATCH.
+ */
+template <typename Signature>
+class RegisterDispatch;
+
+template <typename Ret, typename... Args>
+class RegisterDispatch<Ret(Args...)>
+{
+public:
+  using function_type = Ret (*)(Args...);
+
+  struct variant {
+    register_isa isa;
+    function_type function;
+  };
+
+  explicit RegisterDispatch(std::initializer_list<variant> variants,
+                            register_isa cpu_isa = get_cpu_register_isa())
+      : functions{}, selected(nullptr), selected_isa(register_isa::scalar)
+  {
+    for (const variant& v : variants) {
+      functions[static_cast<int>(v.isa)] = v.function;
+    }
+    for (int i = static_cast<int>(cpu_isa); i >= 0; --i) {
+      if (functions[i] != nullptr) {
+        selected = functions[i];
+        selected_isa = static_cast<register_isa>(i);
+        return;
+      }
+    }
+    RAJA_ABORT_OR_THROW("RegisterDispatch has no variant the CPU supports");
+  }
+
+  //! Variant compiled for isa, nullptr if there is none
+  function_type get(register_isa isa) const
+  {
+    return functions[static_cast<int>(isa)];
+  }
+
+  function_type get_selected() const { return selected; }
+
+  register_isa get_selected_isa() const { return selected_isa; }
+
+  //! Call the selected variant
+  template <typename... CallArgs>
+  Ret operator()(CallArgs&&... args) const
+  {
+    return selected(std::forward<CallArgs>(args)...);
+  }
+
+private:
+  function_type functions[num_register_isas];
+  function_type selected;
+  register_isa selected_isa;
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+
+/*!
+ * Namespace that holds the variants of dispatched kernels compiled for an
+ * ISA. The per-ISA sources define their kernels in
+ * RAJA_REGISTER_DISPATCH_NAMESPACE, which raja_add_register_dispatch sets
+ * with RAJA_REGISTER_DISPATCH_ISA, and which otherwise follows the compiler
+ * flags of the translation unit.
+ */
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_scalar raja_register_scalar
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_avx raja_register_avx
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_avx2 raja_register_avx2
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_avx512 raja_register_avx512
+
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_IMPL(ISA) \
+  RAJA_REGISTER_DISPATCH_NAMESPACE_##ISA
+#define RAJA_REGISTER_DISPATCH_NAMESPACE_FOR(ISA) \
+  RAJA_REGISTER_DISPATCH_NAMESPACE_IMPL(ISA)
+
+#if defined(RAJA_REGISTER_DISPATCH_ISA)
+#define RAJA_REGISTER_DISPATCH_NAMESPACE \
+  RAJA_REGISTER_DISPATCH_NAMESPACE_FOR(RAJA_REGISTER_DISPATCH_ISA)
+#elif defined(__AVX512F__)
+#define RAJA_REGISTER_DISPATCH_NAMESPACE raja_register_avx512
+#elif defined(__AVX2__)
+#define RAJA_REGISTER_DISPATCH_NAMESPACE raja_register_avx2
+#elif defined(__AVX__)
+#define RAJA_REGISTER_DISPATCH_NAMESPACE raja_register_avx
+#else
+#define RAJA_REGISTER_DISPATCH_NAMESPACE raja_register_scalar
+#endif
+
+//
+// The variants that exist are named by RAJA_REGISTER_DISPATCH_HAVE_<ISA>,
+// which raja_add_register_dispatch defines for the dispatching target. The
+// scalar variant is always required.
+//
+#define RAJA_REGISTER_DISPATCH_VARIANT(ISA, NAME) \
+  {::RAJA::expt::register_isa::ISA, &raja_register_##ISA::NAME},
+
+#define RAJA_REGISTER_DISPATCH_DECLARE(ISA, NAME, ...) \
+  namespace raja_register_##ISA                        \
+  {                                                    \
+  ::RAJA::expt::dispatch_signature<__VA_ARGS__> NAME;  \
+  }
+
+#if defined(RAJA_REGISTER_DISPATCH_HAVE_AVX)
+#define RAJA_REGISTER_DISPATCH_IF_AVX(...) __VA_ARGS__
+#else
+#define RAJA_REGISTER_DISPATCH_IF_AVX(...)
+#endif
+
+#if defined(RAJA_REGISTER_DISPATCH_HAVE_AVX2)
+#define RAJA_REGISTER_DISPATCH_IF_AVX2(...) __VA_ARGS__
+#else
+#define RAJA_REGISTER_DISPATCH_IF_AVX2(...)
+#endif
+
+#if defined(RAJA_REGISTER_DISPATCH_HAVE_AVX512)
+#define RAJA_REGISTER_DISPATCH_IF_AVX512(...) __VA_ARGS__
+#else
+#define RAJA_REGISTER_DISPATCH_IF_AVX512(...)
+#endif
+
+/*!
+ * Declare the variants of kernel NAME with function type given by the
+ * remaining arguments, and NAME_dispatch() which returns its dispatch table.
+ * Must be used in the namespace that encloses the per-ISA namespaces.
+ */
+#define RAJA_DECLARE_REGISTER_DISPATCH(NAME, ...)                           \
+  RAJA_REGISTER_DISPATCH_DECLARE(scalar, NAME, __VA_ARGS__)                 \
+  RAJA_REGISTER_DISPATCH_IF_AVX(                                            \
+      RAJA_REGISTER_DISPATCH_DECLARE(avx, NAME, __VA_ARGS__))               \
+  RAJA_REGISTER_DISPATCH_IF_AVX2(                                           \
+      RAJA_REGISTER_DISPATCH_DECLARE(avx2, NAME, __VA_ARGS__))              \
+  RAJA_REGISTER_DISPATCH_IF_AVX512(                                         \
+      RAJA_REGISTER_DISPATCH_DECLARE(avx512, NAME, __VA_ARGS__))            \
+  ::RAJA::expt::RegisterDispatch<__VA_ARGS__>& NAME##_dispatch();
+
+/*!
+ * Define NAME_dispatch() for kernel NAME, in one non-ISA specific source of
+ * the target. For example, with
+ *
+ *     RAJA_DEFINE_REGISTER_DISPATCH(daxpy, void(double, const double*,
+ *                                               double*, int))
+ *
+ * daxpy_dispatch()(a, x, y, n) calls raja_register_avx2::daxpy on a CPU
+ * with AVX2 if that variant was built.
+ */
+#define RAJA_DEFINE_REGISTER_DISPATCH(NAME, ...)                             \
+  RAJA_DECLARE_REGISTER_DISPATCH(NAME, __VA_ARGS__)                          \
+  ::RAJA::expt::RegisterDispatch<__VA_ARGS__>& NAME##_dispatch()             \
+  {                                                                          \
+    static ::RAJA::expt::RegisterDispatch<__VA_ARGS__> dispatch{            \
+        {RAJA_REGISTER_DISPATCH_IF_AVX512(                                   \
+            RAJA_REGISTER_DISPATCH_VARIANT(avx512, NAME))                    \
+             RAJA_REGISTER_DISPATCH_IF_AVX2(                                 \
+                 RAJA_REGISTER_DISPATCH_VARIANT(avx2, NAME))                 \
+                 RAJA_REGISTER_DISPATCH_IF_AVX(                              \
+                     RAJA_REGISTER_DISPATCH_VARIANT(avx, NAME))              \
+                     RAJA_REGISTER_DISPATCH_VARIANT(scalar, NAME)}};         \
+    return dispatch;                                                         \
+  }
+
+#endif
@@ -0,0 +1,306 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the RAJA asynchronous host resource, an in-order
+ *          queue of CPU work served by a worker thread.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_HostAsync_HPP
+#define RAJA_util_HostAsync_HPP
+
+#include "RAJA/config.hpp"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "RAJA/util/resource.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * \brief Tasks and completion count of a HostAsync queue, shared by the
+ *        queue, its worker thread, and the events recorded on it.
+ *
+ *        Tasks are numbered in submission order starting at 1, so an
+ *        event is the number of the last task submitted before it and is
+ *        complete once that many tasks have finished.
+ */
+class HostAsyncQueueState
+{
+public:
+  using ticket_type = unsigned long long;
+
+  ticket_type push(std::function<void()> task)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+    ++m_submitted;
+    m_task_cv.notify_one();
+    return m_submitted;
+  }
+
+  ticket_type submitted()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submitted;
+  }
+
+  bool is_complete(ticket_type ticket)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completed >= ticket;
+  }
+
+  void wait_for_ticket(ticket_type ticket)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [&]() { return m_completed >= ticket; });
+  }
+
+  void stop()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+    m_task_cv.notify_one();
+  }
+
+  //! Run tasks in order until stopped, finishing the tasks already queued
+  void run()
+  {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task_cv.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+        if (m_tasks.empty()) {
+          return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+
+      task();
+      // release copies of the work, such as reducers, before completing
+      task = nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_completed;
+      }
+      m_done_cv.notify_all();
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_task_cv;
+  std::condition_variable m_done_cv;
+  std::deque<std::function<void()>> m_tasks;
+  ticket_type m_submitted = 0;
+  ticket_type m_completed = 0;
+  bool m_stop = false;
+};
+
+/*!
+ * \brief Owner of the worker thread of a HostAsync queue.
+ *
+ *        Destroying the queue lets the worker finish the queued tasks and
+ *        joins it. If the last reference is dropped by a task on the worker
+ *        itself the thread is detached instead; it holds its own reference
+ *        to the state.
+ */
+class HostAsyncQueue
+{
+public:
+  HostAsyncQueue() : m_state(std::make_shared<HostAsyncQueueState>())
+  {
+    std::shared_ptr<HostAsyncQueueState> state = m_state;
+    m_worker = std::thread([state]() { state->run(); });
+  }
+
+  HostAsyncQueue(const HostAsyncQueue&) = delete;
+  HostAsyncQueue& operator=(const HostAsyncQueue&) = delete;
+
+  ~HostAsyncQueue()
+  {
+    m_state->stop();
+    if (m_worker.get_id() == std::this_thread::get_id()) {
+      m_worker.detach();
+    } else {
+      m_worker.join();
+    }
+  }
+
+  const std::shared_ptr<HostAsyncQueueState>& state() const { return m_state; }
+
+private:
+  std::shared_ptr<HostAsyncQueueState> m_state;
+  std::thread m_worker;
+};
+
+}  // namespace internal
+
+namespace resources
+{
+
+/*!
+ * \brief Event marking a point in a HostAsync queue, complete once every
+ *        task submitted before it has finished. A default constructed
+ *        event is always complete.
+ */
+class HostAsyncEvent
+{
+public:
+  HostAsyncEvent() = default;
+
+  HostAsyncEvent(std::shared_ptr<internal::HostAsyncQueueState> state,
+                 internal::HostAsyncQueueState::ticket_type ticket)
+      : m_state(std::move(state)), m_ticket(ticket)
+  {
+  }
+
+  bool check() const { return !m_state || m_state->is_complete(m_ticket); }
+
+  void wait() const
+  {
+    if (m_state) {
+      m_state->wait_for_ticket(m_ticket);
+    }
+  }
+
+private:
+  std::shared_ptr<internal::HostAsyncQueueState> m_state;
+  internal::HostAsyncQueueState::ticket_type m_ticket = 0;
+};
+
+/*!
+ * \brief Asynchronous host resource.
+ *
+ *        Work submitted to a HostAsync resource, including forall, kernel,
+ *        scan, and sort with a host execution policy, is queued and run in
+ *        submission order by a worker thread owned by the resource, and the
+ *        call returns immediately. Each default constructed HostAsync has
+ *        its own queue, so work on different HostAsync resources runs
+ *        concurrently, like work on different CUDA streams. Copies of a
+ *        HostAsync share its queue.
+ *
+ *        memcpy, memset, and deallocate are ordered with the other work on
+ *        the queue. Use wait, or an event from get_event, before reading
+ *        results on the calling thread.
+ */
+class HostAsync
+{
+public:
+  HostAsync() : m_queue(std::make_shared<internal::HostAsyncQueue>()) {}
+
+  static HostAsync get_default()
+  {
+    static HostAsync h;
+    return h;
+  }
+
+  Platform get_platform() const { return Platform::host; }
+
+  template <typename T>
+  T* allocate(size_t size, MemoryAccess = MemoryAccess::Device)
+  {
+    return static_cast<T*>(std::malloc(sizeof(T) * size));
+  }
+
+  void* calloc(size_t size, MemoryAccess = MemoryAccess::Device)
+  {
+    void* p = allocate<char>(size);
+    this->memset(p, 0, size);
+    return p;
+  }
+
+  void deallocate(void* p, MemoryAccess = MemoryAccess::Device)
+  {
+    enqueue([p]() { std::free(p); });
+  }
+
+  void memcpy(void* dst, const void* src, size_t size)
+  {
+    enqueue([=]() { std::memcpy(dst, src, size); });
+  }
+
+  void memset(void* p, int val, size_t size)
+  {
+    enqueue([=]() { std::memset(p, val, size); });
+  }
+
+  HostAsyncEvent get_event() const
+  {
+    return HostAsyncEvent(state(), state()->submitted());
+  }
+
+  Event get_event_erased() const { return Event{get_event()}; }
+
+  //! Block the calling thread until all work submitted so far has finished
+  void wait() const { get_event().wait(); }
+
+  /*!
+   * \brief Make later work on this resource wait for e without blocking
+   *        the calling thread.
+   */
+  void wait_for(Event* e)
+  {
+    Event ev = *e;
+    enqueue([ev]() mutable { ev.wait(); });
+  }
+
+  /*!
+   * \brief Submit a callable to run after all work submitted so far.
+   *
+   * \return event that is complete once the callable has run
+   */
+  template <typename Task>
+  HostAsyncEvent enqueue(Task&& task)
+  {
+    return HostAsyncEvent(state(),
+                          state()->push(std::forward<Task>(task)));
+  }
+
+  bool operator==(const HostAsync& other) const
+  {
+    return m_queue == other.m_queue;
+  }
+
+  bool operator!=(const HostAsync& other) const { return !(*this == other); }
+
+private:
+  const std::shared_ptr<internal::HostAsyncQueueState>& state() const
+  {
+    return m_queue->state();
+  }
+
+  std::shared_ptr<internal::HostAsyncQueue> m_queue;
+};
+
+}  // end namespace resources
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
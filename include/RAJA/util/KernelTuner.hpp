@@ -0,0 +1,250 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining KernelTuner, which picks the fastest of
+ *          a set of tile sizes and OpenMP schedules for a kernel at runtime,
+ *          and the cache of the tuned configurations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_KernelTuner_HPP
+#define RAJA_util_KernelTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * \brief OpenMP loop schedules a tuning configuration can select.
+ *
+ * A schedule other than Default is set with omp_set_schedule while the
+ * kernel runs, so it applies to loops with the omp::Runtime schedule, such
+ * as omp_parallel_for_runtime_exec. Without OpenMP it has no effect.
+ */
+enum class TuningSchedule : int {
+  Default = 0,
+  Static = 1,
+  Dynamic = 2,
+  Guided = 3,
+  Auto = 4
+};
+
+/*!
+ * \brief One candidate configuration of a tuned kernel.
+ */
+struct TuningConfig {
+  TuningConfig() = default;
+
+  TuningConfig(std::vector<camp::idx_t> tiles,
+               TuningSchedule sched = TuningSchedule::Default,
+               int chunk = 0)
+      : tile_sizes(std::move(tiles)), schedule(sched), chunk_size(chunk)
+  {
+  }
+
+  //! Tile size i, for the parameters of tile_dynamic statements
+  TileSize tile(std::size_t i) const { return TileSize{tile_sizes.at(i)}; }
+
+  bool operator==(const TuningConfig& other) const
+  {
+    return tile_sizes == other.tile_sizes && schedule == other.schedule &&
+           chunk_size == other.chunk_size;
+  }
+
+  std::vector<camp::idx_t> tile_sizes;
+  TuningSchedule schedule = TuningSchedule::Default;
+  //! Chunk size of the schedule, 0 for the default
+  int chunk_size = 0;
+};
+
+/*!
+ * \brief Tuned configurations keyed by kernel name and problem size.
+ *
+ * The cache can be saved to and loaded from a text file. The default cache
+ * loads the file named by the RAJA_TUNING_CACHE environment variable when
+ * it is first used, so a run with a saved cache skips the tuning. Kernel
+ * names may not contain tabs or newlines.
+ */
+class TuningCache
+{
+public:
+  //! Cache used by default by KernelTuner
+  RAJASHAREDDLL_API static TuningCache& get_default();
+
+  //! Find the configuration of a kernel, returns false if there is none
+  RAJASHAREDDLL_API bool find(const std::string& name,
+                              Index_type problem_size,
+                              TuningConfig& config) const;
+
+  //! Add or replace the configuration of a kernel
+  RAJASHAREDDLL_API void insert(const std::string& name,
+                                Index_type problem_size,
+                                const TuningConfig& config,
+                                double seconds);
+
+  RAJASHAREDDLL_API std::size_t size() const;
+
+  RAJASHAREDDLL_API void clear();
+
+  //! Write the cache to path, returns false if the file can not be written
+  RAJASHAREDDLL_API bool save(const std::string& path) const;
+
+  /*!
+   * Merge the entries of a file written by save into the cache, returns
+   * false if the file can not be read. Errors in the file are fatal.
+   */
+  RAJASHAREDDLL_API bool load(const std::string& path);
+
+private:
+  struct Entry {
+    TuningConfig config;
+    double seconds;
+  };
+
+  mutable std::mutex mutex;
+  std::map<std::pair<std::string, Index_type>, Entry> entries;
+};
+
+/*!
+ * \brief Sets the OpenMP schedule of a configuration for its lifetime.
+ */
+class TuningScheduleGuard
+{
+public:
+  RAJASHAREDDLL_API explicit TuningScheduleGuard(const TuningConfig& config);
+
+  RAJASHAREDDLL_API ~TuningScheduleGuard();
+
+  TuningScheduleGuard(const TuningScheduleGuard&) = delete;
+  TuningScheduleGuard& operator=(const TuningScheduleGuard&) = delete;
+
+private:
+  bool active;
+  int prev_schedule;
+  int prev_chunk;
+};
+
+/*!
+ * \brief Runs a kernel with the fastest of a set of candidate
+ *        configurations.
+ *
+ * The first samples x candidates calls for each problem size run every
+ * candidate samples times and time them. The candidate with the smallest
+ * time is then used for that problem size and stored in the cache, which
+ * is searched before tuning starts. For example:
+ *
+ *     RAJA::expt::KernelTuner tuner("transpose",
+ *                                   {{{16, 16}}, {{32, 32}}, {{64, 8}}});
+ *
+ *     tuner.run(N * N, [&](const RAJA::expt::TuningConfig& c) {
+ *       RAJA::kernel_param<POL>(segments,
+ *                               RAJA::make_tuple(c.tile(0), c.tile(1)),
+ *                               body);
+ *     });
+ *
+ * The body must finish the kernel before it returns, e.g. synchronize the
+ * resource of a device kernel. A tuner is used by one thread at a time.
+ */
+class KernelTuner
+{
+public:
+  RAJASHAREDDLL_API KernelTuner(std::string name,
+                                std::vector<TuningConfig> candidates,
+                                int samples = 3,
+                                TuningCache& cache = TuningCache::get_default());
+
+  /*!
+   * Call body(config) with the configuration to use for problem_size,
+   * timing it while the problem size is being tuned.
+   */
+  template <typename Body>
+  void run(Index_type problem_size, Body&& body)
+  {
+    State& state = get_state(problem_size);
+
+    if (state.tuned) {
+      TuningScheduleGuard guard(state.best);
+      body(static_cast<const TuningConfig&>(state.best));
+      return;
+    }
+
+    const std::size_t candidate = state.next / samples;
+    const TuningConfig& config = candidates[candidate];
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+      TuningScheduleGuard guard(config);
+      body(config);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    record(problem_size,
+           state,
+           candidate,
+           std::chrono::duration<double>(stop - start).count());
+  }
+
+  //! True if the configuration for problem_size has been chosen
+  RAJASHAREDDLL_API bool is_tuned(Index_type problem_size) const;
+
+  //! Configuration the next call to run for problem_size will use
+  RAJASHAREDDLL_API const TuningConfig& get_config(Index_type problem_size);
+
+  const std::string& get_name() const { return name; }
+
+  const std::vector<TuningConfig>& get_candidates() const
+  {
+    return candidates;
+  }
+
+private:
+  struct State {
+    bool tuned = false;
+    TuningConfig best;
+    std::size_t next = 0;
+    std::vector<double> min_seconds;
+  };
+
+  RAJASHAREDDLL_API State& get_state(Index_type problem_size);
+
+  RAJASHAREDDLL_API void record(Index_type problem_size,
+                                State& state,
+                                std::size_t candidate,
+                                double seconds);
+
+  std::string name;
+  std::vector<TuningConfig> candidates;
+  std::size_t samples;
+  TuningCache* cache;
+  std::map<Index_type, State> states;
+};
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,436 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a N-dimensional index
+ *          calculator that orders the index space along a Z-order curve
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_morton_layout_HPP
+#define RAJA_util_morton_layout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+// BMI2 bit deposit/extract instructions, on host compiles for x86-64 CPUs
+// built with them enabled (e.g. -mbmi2 or -march=native)
+#if defined(__BMI2__) && defined(__x86_64__) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+#define RAJA_MORTON_USE_PDEP
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Scatter the low bits of x to the set bits of mask, lowest bit first.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t morton_deposit(uint64_t x,
+                                                     uint64_t mask)
+{
+#if defined(RAJA_MORTON_USE_PDEP)
+  return _pdep_u64(x, mask);
+#else
+  uint64_t res = 0;
+  for (uint64_t bit = 1; mask != 0; bit += bit) {
+    if (x & bit) {
+      res |= mask & (~mask + 1);
+    }
+    mask &= mask - 1;
+  }
+  return res;
+#endif
+}
+
+/*!
+ * Gather the bits of x at the set bits of mask into the low bits of the
+ * result, the inverse of morton_deposit.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t morton_extract(uint64_t x,
+                                                     uint64_t mask)
+{
+#if defined(RAJA_MORTON_USE_PDEP)
+  return _pext_u64(x, mask);
+#else
+  uint64_t res = 0;
+  for (uint64_t bit = 1; mask != 0; bit += bit) {
+    if (x & mask & (~mask + 1)) {
+      res |= bit;
+    }
+    mask &= mask - 1;
+  }
+  return res;
+#endif
+}
+
+/*!
+ * Spread the low 32 bits of x to every second bit.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t morton_spread2(uint64_t x)
+{
+  x &= 0x00000000ffffffffull;
+  x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+  x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+  x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+  x = (x | (x << 2)) & 0x3333333333333333ull;
+  x = (x | (x << 1)) & 0x5555555555555555ull;
+  return x;
+}
+
+/*!
+ * Gather every second bit of x into the low 32 bits, the inverse of
+ * morton_spread2.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t morton_compact2(uint64_t x)
+{
+  x &= 0x5555555555555555ull;
+  x = (x | (x >> 1)) & 0x3333333333333333ull;
+  x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+  x = (x | (x >> 4)) & 0x00ff00ff00ff00ffull;
+  x = (x | (x >> 8)) & 0x0000ffff0000ffffull;
+  x = (x | (x >> 16)) & 0x00000000ffffffffull;
+  return x;
+}
+
+/*!
+ * Spread the low 21 bits of x to every third bit.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t morton_spread3(uint64_t x)
+{
+  x &= 0x00000000001fffffull;
+  x = (x | (x << 32)) & 0x001f00000000ffffull;
+  x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+  x = (x | (x << 8)) & 0x100f00f00f00f00full;
+  x = (x | (x << 4)) & 0x10c30c30c30c30c3ull;
+  x = (x | (x << 2)) & 0x1249249249249249ull;
+  return x;
+}
+
+/*!
+ * Gather every third bit of x into the low 21 bits, the inverse of
+ * morton_spread3.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t morton_compact3(uint64_t x)
+{
+  x &= 0x1249249249249249ull;
+  x = (x | (x >> 2)) & 0x10c30c30c30c30c3ull;
+  x = (x | (x >> 4)) & 0x100f00f00f00f00full;
+  x = (x | (x >> 8)) & 0x001f0000ff0000ffull;
+  x = (x | (x >> 16)) & 0x001f00000000ffffull;
+  x = (x | (x >> 32)) & 0x00000000001fffffull;
+  return x;
+}
+
+/*!
+ * Interleaving of n_dims indices that all have the same number of bits with
+ * shift and mask sequences, available in 2d and 3d.
+ */
+template <size_t n_dims>
+struct MortonUniform {
+  static constexpr bool enabled = false;
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t encode(const uint64_t *)
+  {
+    return 0;
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t decode(uint64_t, int)
+  {
+    return 0;
+  }
+};
+
+template <>
+struct MortonUniform<2> {
+  static constexpr bool enabled = true;
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t encode(const uint64_t *idx)
+  {
+    return morton_spread2(idx[0]) << 1 | morton_spread2(idx[1]);
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t decode(uint64_t lin, int shift)
+  {
+    return morton_compact2(lin >> shift);
+  }
+};
+
+template <>
+struct MortonUniform<3> {
+  static constexpr bool enabled = true;
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t encode(const uint64_t *idx)
+  {
+    return morton_spread3(idx[0]) << 2 | morton_spread3(idx[1]) << 1 |
+           morton_spread3(idx[2]);
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE static uint64_t decode(uint64_t lin, int shift)
+  {
+    return morton_compact3(lin >> shift);
+  }
+};
+
+
+template <typename Range, typename IdxLin = Index_type>
+struct MortonLayoutBase_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  //! Largest number of bits of a linear index
+  static constexpr int max_bits = 63;
+
+  IdxLin sizes[n_dims] = {0};
+  uint64_t masks[n_dims] = {0};
+  int num_bits = 0;
+  bool uniform = false;
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE MortonLayoutBase_impl() = default;
+  constexpr RAJA_INLINE MortonLayoutBase_impl(MortonLayoutBase_impl const &) =
+      default;
+  constexpr RAJA_INLINE MortonLayoutBase_impl(MortonLayoutBase_impl &&) =
+      default;
+  RAJA_INLINE MortonLayoutBase_impl &operator=(
+      MortonLayoutBase_impl const &) = default;
+  RAJA_INLINE MortonLayoutBase_impl &operator=(MortonLayoutBase_impl &&) =
+      default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   *
+   * Each dimension gets the bits to index its size rounded up to a power of
+   * two. The bits of the dimensions are interleaved from the lowest bit up,
+   * the last (right-most) dimension first, and dimensions that run out of
+   * bits drop out of the interleaving.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE MortonLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+
+    int bits[n_dims] = {0};
+    int max_dim_bits = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      while (bits[d] < max_bits && (IdxLin(1) << bits[d]) < sizes[d]) {
+        ++bits[d];
+      }
+      max_dim_bits = bits[d] > max_dim_bits ? bits[d] : max_dim_bits;
+    }
+
+    num_bits = 0;
+    for (int level = 0; level < max_dim_bits; ++level) {
+      for (size_t d = n_dims; d-- > 0;) {
+        if (level < bits[d]) {
+          if (num_bits >= max_bits) {
+            RAJA_ABORT_OR_THROW("MortonLayout index space too large");
+          }
+          masks[d] |= uint64_t(1) << num_bits;
+          ++num_bits;
+        }
+      }
+    }
+
+    // all dimensions with the same number of bits interleave in a fixed
+    // pattern, which has a fast path in 2d and 3d
+    uniform = MortonUniform<n_dims>::enabled;
+    for (size_t d = 0; d < n_dims; ++d) {
+      uniform = uniform && bits[d] == bits[0];
+    }
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (sizes[N] > 0 && !(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is formed by interleaving the bits of the indices.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(stripIndexType(indices)...);
+#endif
+    const uint64_t idx[n_dims] = {uint64_t(stripIndexType(indices))...};
+#if !defined(RAJA_MORTON_USE_PDEP)
+    if (uniform) {
+      return IdxLin(MortonUniform<n_dims>::encode(idx));
+    }
+#endif
+    uint64_t lin = 0;
+    for (size_t d = 0; d < n_dims; ++d) {
+      lin |= morton_deposit(idx[d], masks[d]);
+    }
+    return IdxLin(lin);
+  }
+
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Linear indices in the padding to powers of two produce indices past
+   * the size of their dimension. Projected dimensions produce zero.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    IdxLin totSize = size();
+    if (linear_index < 0 || linear_index >= totSize) {
+      printf("Error! Linear index %ld is not within bounds [0, %ld]. \n",
+             static_cast<long int>(linear_index),
+             static_cast<long int>(totSize - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+#endif
+    const uint64_t lin = uint64_t(linear_index);
+#if !defined(RAJA_MORTON_USE_PDEP)
+    if (uniform) {
+      camp::sink((indices = (camp::decay<Indices>)(MortonUniform<n_dims>::decode(
+                      lin, int(n_dims - 1 - RangeInts))))...);
+      return;
+    }
+#endif
+    camp::sink((indices = (camp::decay<Indices>)(
+                    morton_extract(lin, masks[RangeInts])))...);
+  }
+
+  /*!
+   * Computes the size of the linear space of the layout, the product of the
+   * sizes of the dimensions each rounded up to a power of two.
+   *
+   * This is the number of elements to allocate for a View.
+   *
+   * @return Total size spanned by the linear indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return IdxLin(1) << num_bits;
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_size() const
+  {
+    return sizes[DIM];
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_begin() const
+  {
+    return 0;
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr int
+    MortonLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin>::max_bits;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space along
+ *        a Morton (Z-order) curve.
+ *
+ * The linear index interleaves the bits of the indices, so elements that
+ * are close in every dimension are close in memory at every scale. Walking a
+ * View along any dimension, or over a block of it, touches few pages and
+ * cache lines without a choice of tile size.
+ *
+ * For example:
+ *
+ *     MortonLayout<2> layout(4, 4);
+ *
+ *     // i = 0b10, j = 0b11 -> bits i1 j1 i0 j0 = 0b1101
+ *     Index_type lin = layout(2, 3);     // lin = 13
+ *
+ *     int i, j;
+ *     layout.toIndices(lin, i, j);       // i, j = {2, 3}
+ *
+ * Each dimension is padded to a power of two, and a dimension with fewer
+ * bits than the others stops taking part in the interleaving once its bits
+ * are used, so a 1024 x 16 space needs 1024 * 16 elements. size() returns the
+ * number of elements to allocate. Dimensions of size 0 or 1 are projected.
+ *
+ * The bits are interleaved with the BMI2 pdep and pext instructions when the
+ * code is built for CPUs with them, otherwise with shift and mask sequences
+ * when all dimensions of a 2d or 3d layout have the same number of bits, and
+ * with a loop over the bits in other cases.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using MortonLayout =
+    detail::MortonLayoutBase_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+}  // namespace RAJA
+
+#endif
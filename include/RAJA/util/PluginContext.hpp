@@ -8,8 +8,12 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <iterator>
+#include <string>
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA {
 namespace util {
@@ -21,18 +25,98 @@ struct PluginContext {
     PluginContext(const Platform p) :
       platform(p) {}
 
+    PluginContext(const Platform p,
+                  const char* policy,
+                  Index_type iterations,
+                  const char* name) :
+      platform(p),
+      policy_name(policy),
+      num_iterations(iterations),
+      kernel_name(name) {}
+
     Platform platform;
 
+    //! Name of the execution policy type, "unknown" if not available
+    const char* policy_name = "unknown";
+
+    //! Number of iterations of the loop or kernel, -1 if not known
+    Index_type num_iterations = -1;
+
+    //! User-supplied name of the kernel, nullptr if none was given
+    const char* kernel_name = nullptr;
+
   private:
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
+namespace detail
+{
+
+//! Extract the type from the signature of type_name<T>() in sig
+inline std::string type_name_from_signature(const std::string& sig)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  const std::string prefix = "type_name<";
+  const std::string::size_type first = sig.find(prefix);
+  const std::string::size_type last = sig.rfind(">(");
+#else
+  const std::string prefix = "T = ";
+  const std::string::size_type first = sig.find(prefix);
+  std::string::size_type last = sig.find(';', first);
+  if (last == std::string::npos) {
+    last = sig.rfind(']');
+  }
+#endif
+  if (first == std::string::npos || last == std::string::npos ||
+      last <= first + prefix.size()) {
+    return "unknown";
+  }
+  return sig.substr(first + prefix.size(), last - first - prefix.size());
+}
+
+/*!
+ * \brief Returns the name of type T taken from the signature of this
+ *        function, computed once per type.
+ */
+template<typename T>
+const char* type_name()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  static const std::string name = type_name_from_signature(__FUNCSIG__);
+#else
+  static const std::string name = type_name_from_signature(__PRETTY_FUNCTION__);
+#endif
+  return name.c_str();
+}
+
+//! Number of iterations over a container, reported to the plugins
+template<typename Container>
+Index_type num_iterations(Container const& c)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  return static_cast<Index_type>(distance(begin(c), end(c)));
+}
+
+} // closing brace for detail namespace
+
+/*!
+ * \brief Make the context passed to the plugins for a launch with Policy.
+ *
+ * \param num_iterations Number of iterations of the launch, -1 if not known
+ * \param kernel_name User-supplied name of the launch, nullptr if none
+ */
 template<typename Policy>
-PluginContext make_context()
+PluginContext make_context(Index_type num_iterations = -1,
+                           const char* kernel_name = nullptr)
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  return PluginContext{::RAJA::detail::get_platform<Policy>::value,
+                       detail::type_name<Policy>(),
+                       num_iterations,
+                       kernel_name};
 }
 
 } // closing brace for util namespace
@@ -0,0 +1,287 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA replicated atomic views, which send the
+ *          atomic updates of each thread to a private copy of the view data.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReplicatedAtomicView_HPP
+#define RAJA_util_ReplicatedAtomicView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
+
+namespace RAJA
+{
+
+//! Bytes of private copies make_replicated_atomic_view uses at most by default
+constexpr size_t replicated_atomic_view_budget = size_t(4) << 20;
+
+//! Alignment and padding of each private copy of a replicated atomic view
+constexpr size_t replicated_atomic_view_align = 64;
+
+namespace detail
+{
+
+//! Bytes of one private copy of n objects of type T, padded to a cache line
+template <typename T>
+RAJA_INLINE size_t replicated_atomic_copy_bytes(size_t n)
+{
+  const size_t bytes = n * sizeof(T);
+  return (bytes + replicated_atomic_view_align - 1) /
+         replicated_atomic_view_align * replicated_atomic_view_align;
+}
+
+//! Number of the calling thread in the innermost parallel region
+RAJA_INLINE int replicated_atomic_thread_num()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+//! Number of threads the next parallel region runs with
+RAJA_INLINE int replicated_atomic_max_threads()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Number of private copies make_replicated_atomic_view uses for a view
+ *        of n objects of type T when run with num_threads threads.
+ *
+ *        Every thread gets its own copy when all copies fit in budget bytes.
+ *        Otherwise threads share as many copies as fit, down to one copy for
+ *        views so large that threads rarely update the same cache line.
+ */
+template <typename T>
+RAJA_INLINE int get_replicated_atomic_view_replication(
+    size_t n,
+    int num_threads,
+    size_t budget = replicated_atomic_view_budget)
+{
+  const size_t copy_bytes = detail::replicated_atomic_copy_bytes<T>(n);
+  if (num_threads <= 1 || copy_bytes == 0) {
+    return 1;
+  }
+  const size_t fit = budget / copy_bytes;
+  if (fit <= 1) {
+    return 1;
+  }
+  return fit < static_cast<size_t>(num_threads) ? static_cast<int>(fit)
+                                                : num_threads;
+}
+
+namespace internal
+{
+
+/*!
+ * Reference to an element of a private copy of a replicated atomic view.
+ *
+ * The private copies start at zero and are added into the view when merged,
+ * so only additive updates are provided.
+ */
+template <typename T, typename AtomicPolicy>
+class ReplicatedAtomicRef
+{
+public:
+  using value_type = T;
+
+  RAJA_INLINE
+  constexpr explicit ReplicatedAtomicRef(value_type *ptr) : m_value_ptr(ptr) {}
+
+  RAJA_INLINE void operator+=(value_type rhs) const
+  {
+    RAJA::atomicAdd<AtomicPolicy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE void operator-=(value_type rhs) const
+  {
+    RAJA::atomicSub<AtomicPolicy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE void operator++() const
+  {
+    RAJA::atomicAdd<AtomicPolicy>(m_value_ptr, value_type(1));
+  }
+
+  RAJA_INLINE void operator++(int) const
+  {
+    RAJA::atomicAdd<AtomicPolicy>(m_value_ptr, value_type(1));
+  }
+
+  RAJA_INLINE void operator--() const
+  {
+    RAJA::atomicSub<AtomicPolicy>(m_value_ptr, value_type(1));
+  }
+
+  RAJA_INLINE void operator--(int) const
+  {
+    RAJA::atomicSub<AtomicPolicy>(m_value_ptr, value_type(1));
+  }
+
+private:
+  value_type *m_value_ptr;
+};
+
+}  // namespace internal
+
+/*!
+ * \brief Atomic view that sends the updates of each thread to a private copy
+ *        of the view data, so threads that update the same entries do not
+ *        contend for the same cache lines.
+ *
+ *        Thread t of a parallel region updates copy t % get_num_replicas()
+ *        with AtomicPolicy, so copies may be shared by groups of threads.
+ *        The copies are added into the view, and reset to zero, by merge,
+ *        which must be called after the kernels that update the view.
+ *        Only additive updates (+=, -=, ++, --) are supported.
+ *
+ *        Copies of the object, such as lambda captures, share the private
+ *        copies, which are released with the last of them. The view must
+ *        be a RAJA::View or RAJA::TypedView of host memory.
+ */
+template <typename ViewType, typename AtomicPolicy = RAJA::auto_atomic>
+class ReplicatedAtomicViewWrapper
+{
+public:
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using atomic_type = internal::ReplicatedAtomicRef<value_type, AtomicPolicy>;
+
+  static_assert(!std::is_const<value_type>::value,
+                "ReplicatedAtomicViewWrapper requires a non-const view");
+
+  ReplicatedAtomicViewWrapper(ViewType const &view, int num_replicas)
+      : base_(view),
+        m_size(view.get_layout().size()),
+        m_stride(detail::replicated_atomic_copy_bytes<value_type>(m_size) /
+                 sizeof(value_type)),
+        m_num_replicas(num_replicas)
+  {
+    static_assert(replicated_atomic_view_align % sizeof(value_type) == 0,
+                  "ReplicatedAtomicViewWrapper value type size must divide "
+                  "the cache line size");
+
+    if (m_num_replicas < 1) {
+      RAJA_ABORT_OR_THROW(
+          "ReplicatedAtomicViewWrapper needs at least one replica");
+    }
+
+    const size_t len = m_stride * static_cast<size_t>(m_num_replicas);
+    m_replicas = allocate_aligned_type<value_type>(replicated_atomic_view_align,
+                                                   len * sizeof(value_type));
+    if (m_replicas == nullptr && len != 0) {
+      RAJA_ABORT_OR_THROW(
+          "ReplicatedAtomicViewWrapper memory allocation failed");
+    }
+    m_storage = std::shared_ptr<value_type>(m_replicas, FreeAligned{});
+    for (size_t i = 0; i < len; ++i) {
+      m_replicas[i] = value_type(0);
+    }
+  }
+
+  //! Number of private copies of the view data
+  RAJA_INLINE int get_num_replicas() const { return m_num_replicas; }
+
+  RAJA_INLINE base_type const &get_view() const { return base_; }
+
+  template <typename... ARGS>
+  RAJA_INLINE atomic_type operator()(ARGS &&... args) const
+  {
+    const size_t offset =
+        &base_.operator()(std::forward<ARGS>(args)...) - base_.get_data();
+    const size_t replica =
+        detail::replicated_atomic_thread_num() % m_num_replicas;
+    return atomic_type(&m_replicas[replica * m_stride + offset]);
+  }
+
+  /*!
+   * \brief Add the private copies into the view and reset them to zero,
+   *        running one iteration of ExecPolicy per view entry.
+   */
+  template <typename ExecPolicy>
+  void merge() const
+  {
+    value_type *data = base_.get_data();
+    value_type *replicas = m_replicas;
+    const size_t stride = m_stride;
+    const size_t num_replicas = m_num_replicas;
+
+    forall<ExecPolicy>(TypedRangeSegment<size_t>(0, m_size), [=](size_t i) {
+      value_type sum = data[i];
+      for (size_t r = 0; r < num_replicas; ++r) {
+        sum += replicas[r * stride + i];
+        replicas[r * stride + i] = value_type(0);
+      }
+      data[i] = sum;
+    });
+  }
+
+private:
+  base_type base_;
+  size_t m_size;
+  size_t m_stride;
+  int m_num_replicas;
+  value_type *m_replicas = nullptr;
+  std::shared_ptr<value_type> m_storage;
+};
+
+/*!
+ * \brief Make a replicated atomic view of view with num_replicas private
+ *        copies, or with get_replicated_atomic_view_replication copies for
+ *        the current number of threads when num_replicas is zero.
+ */
+template <typename AtomicPolicy, typename ViewType>
+RAJA_INLINE ReplicatedAtomicViewWrapper<ViewType, AtomicPolicy>
+make_replicated_atomic_view(ViewType const &view, int num_replicas = 0)
+{
+  if (num_replicas == 0) {
+    num_replicas =
+        get_replicated_atomic_view_replication<typename ViewType::value_type>(
+            view.get_layout().size(), detail::replicated_atomic_max_threads());
+  }
+  return ReplicatedAtomicViewWrapper<ViewType, AtomicPolicy>(view,
+                                                             num_replicas);
+}
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,282 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining TiledLayout, a N-dimensional index
+ *          calculator that stores the index space in fixed size tiles
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_tiled_layout_HPP
+#define RAJA_util_tiled_layout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename IdxLin, typename Range, typename TileSizes>
+struct TiledLayoutBase_impl;
+
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... TileSizes>
+struct TiledLayoutBase_impl<IdxLin,
+                            camp::idx_seq<RangeInts...>,
+                            camp::idx_seq<TileSizes...>> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+  static constexpr ptrdiff_t stride_one_dim = -1;
+
+  static_assert(sizeof...(TileSizes) == n_dims,
+                "number of tile sizes must match number of dimensions");
+  static_assert(RAJA::min<camp::idx_t>(TileSizes...) > 0,
+                "tile sizes must be positive");
+
+  //! Number of elements in one tile
+  static constexpr IdxLin tile_volume =
+      RAJA::product<IdxLin>(IdxLin(TileSizes)...);
+
+  IdxLin sizes[n_dims] = {0};
+  IdxLin num_tiles[n_dims] = {0};
+  IdxLin tile_strides[n_dims] = {0};
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  constexpr RAJA_INLINE TiledLayoutBase_impl() = default;
+  constexpr RAJA_INLINE TiledLayoutBase_impl(TiledLayoutBase_impl const &) =
+      default;
+  constexpr RAJA_INLINE TiledLayoutBase_impl(TiledLayoutBase_impl &&) =
+      default;
+  RAJA_INLINE TiledLayoutBase_impl &operator=(TiledLayoutBase_impl const &) =
+      default;
+  RAJA_INLINE TiledLayoutBase_impl &operator=(TiledLayoutBase_impl &&) =
+      default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   *
+   * Each dimension is rounded up to a whole number of tiles.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr TiledLayoutBase_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        num_tiles{static_cast<IdxLin>((sizes[RangeInts] + IdxLin(TileSizes - 1)) /
+                                      IdxLin(TileSizes))...},
+        tile_strides{(detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+            tile_volume,
+            num_tiles))...}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+  }
+
+  /*!
+   * Stride of the index of dimension Dim inside a tile, the tiles are
+   * stored with the last (right-most) index stride-1.
+   */
+  template <camp::idx_t Dim>
+  RAJA_INLINE RAJA_HOST_DEVICE static constexpr IdxLin get_tile_stride()
+  {
+    return RAJA::product<IdxLin>(
+        (RangeInts > Dim ? IdxLin(TileSizes) : IdxLin(1))...);
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (!(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   *
+   * The index of the tile is formed by the dot product of the tile
+   * coordinates and the tile strides, the offset in the tile by the dot
+   * product of the coordinates in the tile and the compile-time strides
+   * in a tile. With power of two tile sizes the divisions are shifts.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin
+  operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(stripIndexType(indices)...);
+#endif
+    using UIdx = typename std::make_unsigned<IdxLin>::type;
+    return sum<IdxLin>(
+        (IdxLin(UIdx(stripIndexType(indices)) / UIdx(TileSizes)) *
+             tile_strides[RangeInts] +
+         IdxLin(UIdx(stripIndexType(indices)) % UIdx(TileSizes)) *
+             get_tile_stride<RangeInts>())...);
+  }
+
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Linear indices in the padding of partial tiles produce indices past
+   * the size of their dimension.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    IdxLin totSize = size();
+    if (linear_index < 0 || linear_index >= totSize) {
+      printf("Error! Linear index %ld is not within bounds [0, %ld]. \n",
+             static_cast<long int>(linear_index),
+             static_cast<long int>(totSize - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+#endif
+    using UIdx = typename std::make_unsigned<IdxLin>::type;
+    const UIdx lin = UIdx(linear_index);
+    const UIdx in_tile = lin % UIdx(tile_volume);
+
+    camp::sink((indices = (camp::decay<Indices>)(
+                    IdxLin((lin / UIdx(tile_strides[RangeInts])) %
+                           UIdx(num_tiles[RangeInts] ? num_tiles[RangeInts]
+                                                     : IdxLin(1))) *
+                        IdxLin(TileSizes) +
+                    IdxLin((in_tile / UIdx(get_tile_stride<RangeInts>())) %
+                           UIdx(TileSizes))))...);
+  }
+
+  /*!
+   * Computes the size of the linear space of the layout, the number of
+   * elements in all tiles including the padding of partial tiles.
+   *
+   * This is the number of elements to allocate for a View.
+   *
+   * @return Total size spanned by the linear indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(),
+                 num_tiles[RangeInts]...) *
+           tile_volume;
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_size() const
+  {
+    return sizes[DIM];
+  }
+
+  template <camp::idx_t DIM>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IndexLinear get_dim_begin() const
+  {
+    return 0;
+  }
+};
+
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... TileSizes>
+constexpr size_t TiledLayoutBase_impl<IdxLin,
+                                      camp::idx_seq<RangeInts...>,
+                                      camp::idx_seq<TileSizes...>>::n_dims;
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... TileSizes>
+constexpr IdxLin TiledLayoutBase_impl<IdxLin,
+                                      camp::idx_seq<RangeInts...>,
+                                      camp::idx_seq<TileSizes...>>::tile_volume;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space that
+ *        stores the space in tiles of compile-time size.
+ *
+ * The index space is cut into tiles of TileSizes... elements. The tiles are
+ * stored one after the other, with the tile grid and the elements in each
+ * tile both ordered with the last (right-most) index stride-1. A stencil or
+ * a transpose that walks a View along any dimension then touches whole tiles
+ * instead of one element of each of many rows, which keeps the pages and
+ * cache lines it uses few.
+ *
+ * For example:
+ *
+ *     // 100 x 100 space in 16 x 16 tiles
+ *     TiledLayout<16, 16> layout(100, 100);
+ *
+ *     // 7 x 7 tiles, 7*7*256 = 12544 elements to allocate
+ *     Index_type n = layout.size();
+ *
+ *     // Tile (1, 2), position (1, 3) in the tile
+ *     Index_type lin = layout(17, 35);   // lin = 9*256 + 1*16 + 3 = 2323
+ *
+ *     int i, j;
+ *     layout.toIndices(lin, i, j);       // i, j = {17, 35}
+ *
+ * Dimensions that are not a multiple of their tile size are padded to a
+ * whole number of tiles. Power of two tile sizes turn the index divisions
+ * into shifts. Projected (size zero) dimensions are not supported.
+ */
+template <typename IdxLin, camp::idx_t... TileSizes>
+using TiledLayoutT =
+    detail::TiledLayoutBase_impl<IdxLin,
+                                 camp::make_idx_seq_t<sizeof...(TileSizes)>,
+                                 camp::idx_seq<TileSizes...>>;
+
+template <camp::idx_t... TileSizes>
+using TiledLayout = TiledLayoutT<Index_type, TileSizes...>;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Trace_Plugin_HPP
+#define RAJA_Trace_Plugin_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA {
+namespace util {
+
+/*!
+ * \brief Plugin that times every launch and reports per-kernel statistics.
+ *
+ * The plugin is registered by the application, for instance with
+ *
+ *     static RAJA::util::PluginRegistry::add<RAJA::util::TracePlugin>
+ *         P("raja-trace", "Per-kernel timing");
+ *
+ * Launches are grouped by their RAJA::expt::KernelName, or by their policy
+ * when they have no name. Each thread records into its own buffers, so the
+ * cost of a launch is two clock reads and a lookup in a small table.
+ *
+ * At finalize() the plugin writes a summary table, to the file named by the
+ * RAJA_TRACE_SUMMARY environment variable or to stdout, and a Chrome trace
+ * event file, to the file named by RAJA_TRACE_FILE or "raja-trace.json".
+ * Setting RAJA_TRACE_FILE to an empty string skips the trace. At most
+ * RAJA_TRACE_MAX_EVENTS (default 1000000) events are kept for the trace,
+ * the statistics include all launches.
+ *
+ * The time of a launch is the time between preLaunch and postLaunch. For
+ * asynchronous device launches that is the time to enqueue the kernel.
+ */
+class TracePlugin : public ::RAJA::util::PluginStrategy
+{
+public:
+  using Parent = ::RAJA::util::PluginStrategy;
+
+  //! Statistics of the launches of one kernel
+  struct KernelStats {
+    std::string name;
+    std::string policy;
+    Platform platform;
+    std::size_t calls;
+    double total_seconds;
+    double min_seconds;
+    double max_seconds;
+    //! Sum of the iterations of the launches with a known count
+    long long iterations;
+  };
+
+  RAJASHAREDDLL_API TracePlugin();
+
+  RAJASHAREDDLL_API ~TracePlugin();
+
+  RAJASHAREDDLL_API void preLaunch(const PluginContext& p) override;
+
+  RAJASHAREDDLL_API void postLaunch(const PluginContext& p) override;
+
+  RAJASHAREDDLL_API void finalize() override;
+
+  //
+  // The accessors below read the buffers of all threads, they must not be
+  // called while launches are running.
+  //
+
+  //! Statistics merged over all threads, sorted by decreasing total time
+  RAJASHAREDDLL_API std::vector<KernelStats> getStats() const;
+
+  //! Number of launches left out of the trace events
+  RAJASHAREDDLL_API std::size_t getNumDroppedEvents() const;
+
+  RAJASHAREDDLL_API void writeSummary(std::ostream& os) const;
+
+  RAJASHAREDDLL_API void writeTrace(std::ostream& os) const;
+
+private:
+  struct ThreadData;
+
+  ThreadData& getThreadData();
+
+  const std::size_t id;
+  const std::chrono::steady_clock::time_point start;
+
+  std::size_t max_events;
+  std::atomic<std::size_t> num_events;
+
+  mutable std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadData>> threads;
+
+};  // end TracePlugin class
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -18,12 +18,18 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <limits>
 #include <list>
 #include <map>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -419,6 +425,322 @@ struct generic_allocator {
   }
 };
 
+/*! \class SizeClassMemPool
+ ******************************************************************************
+ *
+ * \brief  SizeClassMemPool hands out blocks from power of two size classes
+ * with per thread caches of free blocks, so allocation and deallocation are
+ * O(1) and usually take no lock
+ *
+ * Each thread keeps a bin of free blocks per size class. A thread refills an
+ * empty bin with a batch of blocks from the shared free list of that class,
+ * carving new blocks out of large slabs from allocator_t when the shared list
+ * runs out, and returns half of a full bin to the shared list. Requests
+ * larger than the biggest size class go to allocator_t directly.
+ *
+ * Unlike MemPool, free needs the size and alignment the memory was
+ * allocated with. The free lists are kept outside of the blocks so the
+ * memory from allocator_t does not have to be host accessible. Slabs are
+ * kept for reuse for the life of the program.
+ *
+ * size_class_allocator wraps the pool in the std allocator interface, for
+ * example to use it as the allocator of RAJA::WorkPool.
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class SizeClassMemPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  //! smallest size class is 16 bytes, largest is 1 MiB
+  static const size_t min_block_log2 = 4;
+  static const size_t max_block_log2 = 20;
+  static const size_t num_size_classes = max_block_log2 - min_block_log2 + 1;
+
+  //! blocks are aligned to their size up to this alignment
+  static const size_t max_block_alignment = 4096;
+
+  //! bytes carved from allocator_t at a time for each size class
+  static const size_t default_slab_size = 256ull * 1024ull;
+
+  //! bytes of free blocks each thread caches per size class
+  static const size_t thread_cache_size = 64ull * 1024ull;
+
+  //! the pool is never destroyed so thread caches can be returned to it
+  //! whenever threads exit
+  static inline SizeClassMemPool<allocator_t>& getInstance()
+  {
+    static SizeClassMemPool<allocator_t>* pool =
+        new SizeClassMemPool<allocator_t>{};
+    return *pool;
+  }
+
+  SizeClassMemPool(SizeClassMemPool const&) = delete;
+  SizeClassMemPool& operator=(SizeClassMemPool const&) = delete;
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const size_t size = nTs * sizeof(T);
+    const size_t cls = size_class(size, alignment);
+    if (cls == num_size_classes) {
+      return static_cast<T*>(large_malloc(size, alignment));
+    }
+
+    std::vector<void*>& bin = thread_cache().bins[cls];
+    if (bin.empty()) {
+      refill(cls, bin);
+      if (bin.empty()) {
+        return nullptr;
+      }
+    }
+    void* ptr = bin.back();
+    bin.pop_back();
+    return static_cast<T*>(ptr);
+  }
+
+  //! nTs and alignment must match the call to malloc that returned cptr
+  template <typename T>
+  void free(const T* cptr, size_t nTs, size_t alignment = alignof(T))
+  {
+    void* ptr = const_cast<void*>(static_cast<const void*>(cptr));
+    if (ptr == nullptr) {
+      return;
+    }
+
+    const size_t cls = size_class(nTs * sizeof(T), alignment);
+    if (cls == num_size_classes) {
+      large_free(ptr);
+      return;
+    }
+
+    std::vector<void*>& bin = thread_cache().bins[cls];
+    bin.push_back(ptr);
+    if (bin.size() >= bin_limit(cls)) {
+      // return the least recently freed half to the shared list
+      const size_t num = bin.size() / 2;
+      lock_guard<std::mutex> lock(m_mutex);
+      std::vector<void*>& shared = m_classes[cls].free_blocks;
+      shared.insert(shared.end(), bin.begin(), bin.begin() + num);
+      bin.erase(bin.begin(), bin.begin() + num);
+    }
+  }
+
+  //! return the free blocks cached by the calling thread to the shared lists
+  void release_thread_cache() { release(thread_cache()); }
+
+private:
+  struct SizeClass {
+    std::vector<void*> free_blocks;
+    char* slab_next = nullptr;
+    char* slab_end = nullptr;
+  };
+
+  struct ThreadCache {
+    std::vector<void*> bins[num_size_classes];
+
+    ~ThreadCache() { getInstance().release(*this); }
+  };
+
+  SizeClassMemPool() = default;
+
+  static ThreadCache& thread_cache()
+  {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  //! index of the smallest size class holding size bytes with the given
+  //! alignment, num_size_classes if there is none
+  static size_t size_class(size_t size, size_t alignment)
+  {
+    if (alignment > max_block_alignment) {
+      return num_size_classes;
+    }
+    const size_t nbytes = std::max(size, alignment);
+    size_t cls = 0;
+    size_t block_size = size_t(1) << min_block_log2;
+    while (block_size < nbytes) {
+      if (cls + 1 == num_size_classes) {
+        return num_size_classes;
+      }
+      block_size <<= 1;
+      ++cls;
+    }
+    return cls;
+  }
+
+  static size_t block_size(size_t cls)
+  {
+    return size_t(1) << (cls + min_block_log2);
+  }
+
+  static size_t bin_limit(size_t cls)
+  {
+    return std::max(thread_cache_size / block_size(cls), size_t(2));
+  }
+
+  void refill(size_t cls, std::vector<void*>& bin)
+  {
+    const size_t batch = bin_limit(cls) / 2;
+    const size_t bytes = block_size(cls);
+
+    lock_guard<std::mutex> lock(m_mutex);
+    SizeClass& state = m_classes[cls];
+
+    const size_t num_free = std::min(batch, state.free_blocks.size());
+    bin.insert(bin.end(),
+               state.free_blocks.end() - num_free,
+               state.free_blocks.end());
+    state.free_blocks.resize(state.free_blocks.size() - num_free);
+
+    for (size_t i = num_free; i < batch; ++i) {
+      if (state.slab_next == state.slab_end && !new_slab(state, bytes)) {
+        break;
+      }
+      bin.push_back(state.slab_next);
+      state.slab_next += bytes;
+    }
+  }
+
+  bool new_slab(SizeClass& state, size_t bytes)
+  {
+    const size_t alignment = std::min(bytes, max_block_alignment);
+    const size_t slab_size = std::max(bytes, default_slab_size);
+    size_t space = slab_size + alignment;
+    void* slab_ptr = m_alloc.malloc(space);
+    if (slab_ptr == nullptr) {
+      return false;
+    }
+    m_slabs.push_back(slab_ptr);
+
+    void* ptr = slab_ptr;
+    ::RAJA::align(alignment, slab_size, ptr, space);
+    state.slab_next = static_cast<char*>(ptr);
+    state.slab_end = state.slab_next + slab_size;
+    return true;
+  }
+
+  void release(ThreadCache& cache)
+  {
+    lock_guard<std::mutex> lock(m_mutex);
+    for (size_t cls = 0; cls < num_size_classes; ++cls) {
+      std::vector<void*>& bin = cache.bins[cls];
+      std::vector<void*>& shared = m_classes[cls].free_blocks;
+      shared.insert(shared.end(), bin.begin(), bin.end());
+      bin.clear();
+    }
+  }
+
+  void* large_malloc(size_t size, size_t alignment)
+  {
+    size_t space = size + alignment;
+    void* alloc_ptr = m_alloc.malloc(space);
+    if (alloc_ptr == nullptr) {
+      return nullptr;
+    }
+    void* ptr = alloc_ptr;
+    ::RAJA::align(alignment, size, ptr, space);
+
+    lock_guard<std::mutex> lock(m_mutex);
+    m_large[ptr] = alloc_ptr;
+    return ptr;
+  }
+
+  void large_free(void* ptr)
+  {
+    void* alloc_ptr = nullptr;
+    {
+      lock_guard<std::mutex> lock(m_mutex);
+      auto found = m_large.find(ptr);
+      if (found == m_large.end()) {
+        fprintf(stderr, "Unknown pointer %p", ptr);
+        return;
+      }
+      alloc_ptr = found->second;
+      m_large.erase(found);
+    }
+    m_alloc.free(alloc_ptr);
+  }
+
+  std::mutex m_mutex;
+  SizeClass m_classes[num_size_classes];
+  std::vector<void*> m_slabs;
+  std::unordered_map<void*, void*> m_large;
+  allocator_t m_alloc;
+};
+
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::min_block_log2;
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::max_block_log2;
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::num_size_classes;
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::max_block_alignment;
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::default_slab_size;
+template <typename allocator_t>
+const size_t SizeClassMemPool<allocator_t>::thread_cache_size;
+
+/*!
+ * \brief std allocator using the SizeClassMemPool for allocator_t, for
+ * example as the allocator of RAJA::WorkPool
+ *
+ *   using pool_type = RAJA::WorkPool<policy, RAJA::Index_type,
+ *                                    RAJA::xargs<>,
+ *                                    basic_mempool::size_class_allocator<char>>;
+ */
+template <typename T, typename allocator_t = generic_allocator>
+struct size_class_allocator {
+  using value_type = T;
+  using pool_type = SizeClassMemPool<allocator_t>;
+
+  size_class_allocator() = default;
+
+  template <typename U>
+  constexpr size_class_allocator(
+      size_class_allocator<U, allocator_t> const&) noexcept
+  {
+  }
+
+  value_type* allocate(size_t num)
+  {
+    if (num > std::numeric_limits<size_t>::max() / sizeof(value_type)) {
+      throw std::bad_alloc();
+    }
+
+    value_type* ptr = pool_type::getInstance().template malloc<value_type>(num);
+
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+
+    return ptr;
+  }
+
+  void deallocate(value_type* ptr, size_t num) noexcept
+  {
+    pool_type::getInstance().free(ptr, num);
+  }
+};
+
+template <typename T, typename U, typename allocator_t>
+bool operator==(size_class_allocator<T, allocator_t> const&,
+                size_class_allocator<U, allocator_t> const&)
+{
+  return true;
+}
+
+template <typename T, typename U, typename allocator_t>
+bool operator!=(size_class_allocator<T, allocator_t> const& lhs,
+                size_class_allocator<U, allocator_t> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
 } /* end namespace basic_mempool */
 
 } /* end namespace RAJA */
@@ -0,0 +1,392 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction algorithms (copy_if,
+*          partition, stable_partition, unique) shared by the CPU back-ends.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_compaction_HPP
+#define RAJA_util_compaction_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/sort.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+    \brief exclusive scan of the per chunk counts in counts[1..num_chunks]
+           so counts[chunk] is the offset of chunk
+
+    \return the total count
+*/
+template <typename diff_type>
+RAJA_INLINE diff_type compaction_offsets(std::vector<diff_type>& counts)
+{
+  for (size_t chunk = 1; chunk < counts.size(); ++chunk) {
+    counts[chunk] += counts[chunk - 1];
+  }
+  return counts.back();
+}
+
+/*!
+    \brief copy the elements of [begin, end) for which pred is true to out
+           keeping their relative order
+
+    Each chunk appends its selected elements to a local buffer, the buffer
+    sizes are scanned into output offsets, then each chunk moves its buffer
+    into place.
+
+    \return the number of elements copied
+*/
+template <typename Executor,
+          typename Iter,
+          typename OutIter,
+          typename Predicate>
+size_t copy_if(const Executor& exec,
+               Iter begin,
+               Iter end,
+               OutIter out,
+               Predicate pred)
+{
+  using diff_type = IterDiff<Iter>;
+  using Value = IterVal<Iter>;
+
+  const diff_type n = end - begin;
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    diff_type count = 0;
+    for (diff_type i = 0; i < n; ++i) {
+      if (pred(begin[i])) {
+        out[count] = begin[i];
+        ++count;
+      }
+    }
+    return static_cast<size_t>(count);
+  }
+
+  std::vector<std::vector<Value>> buffers(num_chunks);
+  std::vector<diff_type> offsets(num_chunks + 1, diff_type(0));
+
+  exec(num_chunks, [&](int chunk) {
+    const diff_type lo = firstIndex(n, num_chunks, chunk);
+    const diff_type hi = firstIndex(n, num_chunks, chunk + 1);
+    std::vector<Value>& buffer = buffers[chunk];
+    buffer.reserve(hi - lo);
+    for (diff_type i = lo; i < hi; ++i) {
+      if (pred(begin[i])) {
+        buffer.push_back(begin[i]);
+      }
+    }
+    offsets[chunk + 1] = static_cast<diff_type>(buffer.size());
+  });
+
+  const diff_type count = compaction_offsets(offsets);
+
+  exec(num_chunks, [&](int chunk) {
+    std::vector<Value>& buffer = buffers[chunk];
+    std::move(buffer.begin(), buffer.end(), out + offsets[chunk]);
+    std::vector<Value>().swap(buffer);
+  });
+
+  return static_cast<size_t>(count);
+}
+
+/*!
+    \brief partition [begin, end) inplace so the elements for which pred is
+           true precede the others, keeping the relative order of both
+
+    Each chunk moves its elements into a local true buffer and false buffer,
+    the buffer sizes are scanned into offsets, then each chunk moves its
+    buffers back into place.
+
+    \return the number of elements for which pred is true
+*/
+template <typename Executor,
+          typename Iter,
+          typename Predicate>
+size_t stable_partition(const Executor& exec,
+                        Iter begin,
+                        Iter end,
+                        Predicate pred)
+{
+  using diff_type = IterDiff<Iter>;
+  using Value = IterVal<Iter>;
+
+  const diff_type n = end - begin;
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    // trues are compacted inplace ahead of the read position
+    std::vector<Value> falses;
+    diff_type count = 0;
+    for (diff_type i = 0; i < n; ++i) {
+      if (pred(begin[i])) {
+        if (count != i) {
+          begin[count] = std::move(begin[i]);
+        }
+        ++count;
+      } else {
+        falses.push_back(std::move(begin[i]));
+      }
+    }
+    std::move(falses.begin(), falses.end(), begin + count);
+    return static_cast<size_t>(count);
+  }
+
+  std::vector<std::vector<Value>> true_buffers(num_chunks);
+  std::vector<std::vector<Value>> false_buffers(num_chunks);
+  std::vector<diff_type> true_offsets(num_chunks + 1, diff_type(0));
+  std::vector<diff_type> false_offsets(num_chunks + 1, diff_type(0));
+
+  exec(num_chunks, [&](int chunk) {
+    const diff_type lo = firstIndex(n, num_chunks, chunk);
+    const diff_type hi = firstIndex(n, num_chunks, chunk + 1);
+    std::vector<Value>& trues = true_buffers[chunk];
+    std::vector<Value>& falses = false_buffers[chunk];
+    for (diff_type i = lo; i < hi; ++i) {
+      if (pred(begin[i])) {
+        trues.push_back(std::move(begin[i]));
+      } else {
+        falses.push_back(std::move(begin[i]));
+      }
+    }
+    true_offsets[chunk + 1] = static_cast<diff_type>(trues.size());
+    false_offsets[chunk + 1] = static_cast<diff_type>(falses.size());
+  });
+
+  const diff_type count = compaction_offsets(true_offsets);
+  compaction_offsets(false_offsets);
+
+  exec(num_chunks, [&](int chunk) {
+    std::vector<Value>& trues = true_buffers[chunk];
+    std::vector<Value>& falses = false_buffers[chunk];
+    std::move(trues.begin(), trues.end(), begin + true_offsets[chunk]);
+    std::move(falses.begin(), falses.end(),
+              begin + count + false_offsets[chunk]);
+    std::vector<Value>().swap(trues);
+    std::vector<Value>().swap(falses);
+  });
+
+  return static_cast<size_t>(count);
+}
+
+/*!
+    \brief interval [lo, hi) of misplaced elements and the number of
+           misplaced elements preceding it
+*/
+template <typename diff_type>
+struct CompactionInterval
+{
+  diff_type lo;
+  diff_type hi;
+  diff_type before;
+};
+
+/*!
+    \brief index of the misplaced element with rank m in the ordered list of
+           intervals
+*/
+template <typename diff_type>
+RAJA_INLINE diff_type compaction_interval_index(
+    const std::vector<CompactionInterval<diff_type>>& intervals,
+    size_t& interval,
+    diff_type m)
+{
+  while (m >= intervals[interval].before +
+                  (intervals[interval].hi - intervals[interval].lo)) {
+    ++interval;
+  }
+  return intervals[interval].lo + (m - intervals[interval].before);
+}
+
+/*!
+    \brief partition [begin, end) inplace so the elements for which pred is
+           true precede the others, using O(1) memory per chunk
+
+    Each chunk is partitioned inplace giving the total true count T. The
+    trues left at or after T and the falses left before T are then equal in
+    number and each chunk swaps a share of those pairs.
+
+    \return the number of elements for which pred is true
+*/
+template <typename Executor,
+          typename Iter,
+          typename Predicate>
+size_t partition(const Executor& exec,
+                 Iter begin,
+                 Iter end,
+                 Predicate pred)
+{
+  using diff_type = IterDiff<Iter>;
+  using Interval = CompactionInterval<diff_type>;
+  using ::RAJA::safe_iter_swap;
+
+  auto iter_pred = [&](Iter it) { return static_cast<bool>(pred(*it)); };
+
+  const diff_type n = end - begin;
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    return static_cast<size_t>(
+        RAJA::detail::partition(begin, end, iter_pred) - begin);
+  }
+
+  std::vector<diff_type> true_ends(num_chunks);
+
+  exec(num_chunks, [&](int chunk) {
+    Iter lo = begin + firstIndex(n, num_chunks, chunk);
+    Iter hi = begin + firstIndex(n, num_chunks, chunk + 1);
+    true_ends[chunk] = RAJA::detail::partition(lo, hi, iter_pred) - begin;
+  });
+
+  diff_type count = 0;
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    count += true_ends[chunk] - firstIndex(n, num_chunks, chunk);
+  }
+
+  // collect the trues at or after count and the falses before count
+  std::vector<Interval> misplaced_trues;
+  std::vector<Interval> misplaced_falses;
+  diff_type num_misplaced_trues = 0;
+  diff_type num_misplaced_falses = 0;
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    const diff_type lo = firstIndex(n, num_chunks, chunk);
+    const diff_type hi = firstIndex(n, num_chunks, chunk + 1);
+    const diff_type mid = true_ends[chunk];
+
+    const diff_type true_lo = std::max(lo, count);
+    if (true_lo < mid) {
+      misplaced_trues.push_back(Interval{true_lo, mid, num_misplaced_trues});
+      num_misplaced_trues += mid - true_lo;
+    }
+    const diff_type false_hi = std::min(hi, count);
+    if (mid < false_hi) {
+      misplaced_falses.push_back(Interval{mid, false_hi, num_misplaced_falses});
+      num_misplaced_falses += false_hi - mid;
+    }
+  }
+
+  const diff_type num_misplaced = num_misplaced_trues;
+  if (num_misplaced > 0) {
+    exec(num_chunks, [&](int chunk) {
+      const diff_type m_lo = firstIndex(num_misplaced, num_chunks, chunk);
+      const diff_type m_hi = firstIndex(num_misplaced, num_chunks, chunk + 1);
+      size_t true_interval = 0;
+      size_t false_interval = 0;
+      for (diff_type m = m_lo; m < m_hi; ++m) {
+        const diff_type t =
+            compaction_interval_index(misplaced_trues, true_interval, m);
+        const diff_type f =
+            compaction_interval_index(misplaced_falses, false_interval, m);
+        safe_iter_swap(begin + t, begin + f);
+      }
+    });
+  }
+
+  return static_cast<size_t>(count);
+}
+
+/*!
+    \brief remove inplace all but the first element of each run of
+           consecutive elements of [begin, end) that compare equal with eq
+
+    An element is kept if eq is false when comparing it to the element
+    before it in the input. Each chunk copies its kept elements to a local
+    buffer reading only the input, the buffer sizes are scanned into
+    offsets, then each chunk moves its buffer into place.
+
+    \return the number of elements kept
+*/
+template <typename Executor,
+          typename Iter,
+          typename BinaryPredicate>
+size_t unique(const Executor& exec,
+              Iter begin,
+              Iter end,
+              BinaryPredicate eq)
+{
+  using diff_type = IterDiff<Iter>;
+  using Value = IterVal<Iter>;
+
+  const diff_type n = end - begin;
+  if (n == 0) {
+    return 0;
+  }
+
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    // keep a copy of the previous input as it may be moved from
+    Value prev = begin[0];
+    diff_type count = 1;
+    for (diff_type i = 1; i < n; ++i) {
+      const bool keep = !eq(prev, begin[i]);
+      prev = begin[i];
+      if (keep) {
+        if (count != i) {
+          begin[count] = std::move(begin[i]);
+        }
+        ++count;
+      }
+    }
+    return static_cast<size_t>(count);
+  }
+
+  std::vector<std::vector<Value>> buffers(num_chunks);
+  std::vector<diff_type> offsets(num_chunks + 1, diff_type(0));
+
+  exec(num_chunks, [&](int chunk) {
+    const diff_type lo = firstIndex(n, num_chunks, chunk);
+    const diff_type hi = firstIndex(n, num_chunks, chunk + 1);
+    std::vector<Value>& buffer = buffers[chunk];
+    buffer.reserve(hi - lo);
+    for (diff_type i = lo; i < hi; ++i) {
+      if (i == 0 || !eq(begin[i - 1], begin[i])) {
+        buffer.push_back(begin[i]);
+      }
+    }
+    offsets[chunk + 1] = static_cast<diff_type>(buffer.size());
+  });
+
+  const diff_type count = compaction_offsets(offsets);
+
+  exec(num_chunks, [&](int chunk) {
+    std::vector<Value>& buffer = buffers[chunk];
+    std::move(buffer.begin(), buffer.end(), begin + offsets[chunk]);
+    std::vector<Value>().swap(buffer);
+  });
+
+  return static_cast<size_t>(count);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,84 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA first-touch memory initialization, which
+ *          places the pages of host memory by the iteration-to-thread mapping
+ *          of an execution policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_first_touch_HPP
+#define RAJA_util_first_touch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+namespace RAJA
+{
+
+//! Alignment of memory from first_touch_allocate, a common page size
+constexpr size_t first_touch_page_align = 4096;
+
+/*!
+ * \brief Construct n copies of value at ptr, element i by the thread that
+ *        runs iteration i of a loop of length n with ExecPolicy.
+ *
+ *        Operating systems place a page of memory on the NUMA node of the
+ *        thread that first writes it. With a policy that maps iterations to
+ *        threads the same way in every loop, such as
+ *        RAJA::omp_parallel_for_numa_exec, later loops of length n with that
+ *        policy find their data on their own node.
+ */
+template <typename ExecPolicy, typename T>
+void first_touch(T* ptr, size_t n, const T& value = T())
+{
+  forall<ExecPolicy>(TypedRangeSegment<size_t>(0, n), [=](size_t i) {
+    new (&ptr[i]) T(value);
+  });
+}
+
+/*!
+ * \brief Allocate page aligned memory for n objects of type T and initialize
+ *        it with first_touch.
+ *
+ *        The memory is released with RAJA::free_aligned.
+ */
+template <typename ExecPolicy, typename T>
+T* first_touch_allocate(size_t n, const T& value = T())
+{
+  static_assert(std::is_trivially_destructible<T>::value,
+                "first_touch_allocate requires a trivially destructible type");
+
+  T* ptr = allocate_aligned_type<T>(first_touch_page_align, n * sizeof(T));
+  if (ptr == nullptr && n != 0) {
+    RAJA_ABORT_OR_THROW("first_touch_allocate memory allocation failed");
+  }
+  first_touch<ExecPolicy>(ptr, n, value);
+  return ptr;
+}
+
+}  // namespace RAJA
+
+#endif
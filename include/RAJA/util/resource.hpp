@@ -140,6 +140,20 @@ namespace RAJA
   };
 #endif
 
+  /*!
+   * \brief EventProxy that also holds a value computed by the operation that
+   *        returned it, such as the number of outputs written.
+   */
+  template<typename Res, typename T>
+  struct ValueEventProxy : EventProxy<Res> {
+    ValueEventProxy(Res r, T value) : EventProxy<Res>(r), value_(value) {}
+
+    T value() const { return value_; }
+
+  private:
+    T value_;
+  };
+
   } // end namespace resources
 
   namespace type_traits
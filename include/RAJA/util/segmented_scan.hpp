@@ -0,0 +1,377 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented scan and reduce by key
+*          algorithms shared by the CPU back-ends.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_segmented_scan_HPP
+#define RAJA_util_segmented_scan_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+    \brief Segments given by head flags, a nonzero flag starts a segment
+           and the first element always starts a segment
+*/
+template <typename FlagIter>
+struct SegmentFlags
+{
+  FlagIter flags;
+
+  template <typename diff_type>
+  RAJA_INLINE bool is_head(diff_type i) const
+  {
+    return i == 0 || static_cast<bool>(flags[i]);
+  }
+
+  template <typename diff_type>
+  RAJA_INLINE void write_key(diff_type, diff_type) const
+  {
+  }
+};
+
+/*!
+    \brief Placeholder used when the unique keys are not written out
+*/
+struct NoSegmentKeysOut
+{
+};
+
+/*!
+    \brief Segments given by runs of equal keys, optionally writing the key
+           of each segment to keys_out
+*/
+template <typename KeyIter, typename KeyOutIter = NoSegmentKeysOut>
+struct SegmentKeys
+{
+  KeyIter keys;
+  KeyOutIter keys_out;
+
+  template <typename diff_type>
+  RAJA_INLINE bool is_head(diff_type i) const
+  {
+    return i == 0 || !(keys[i] == keys[i - 1]);
+  }
+
+  template <typename diff_type>
+  RAJA_INLINE void write_key(diff_type segment, diff_type i) const
+  {
+    keys_out[segment] = keys[i];
+  }
+};
+
+template <typename KeyIter>
+struct SegmentKeys<KeyIter, NoSegmentKeysOut>
+{
+  KeyIter keys;
+
+  template <typename diff_type>
+  RAJA_INLINE bool is_head(diff_type i) const
+  {
+    return i == 0 || !(keys[i] == keys[i - 1]);
+  }
+
+  template <typename diff_type>
+  RAJA_INLINE void write_key(diff_type, diff_type) const
+  {
+  }
+};
+
+template <typename T>
+struct is_segments_impl : std::false_type
+{
+};
+
+template <typename FlagIter>
+struct is_segments_impl<SegmentFlags<FlagIter>> : std::true_type
+{
+};
+
+template <typename KeyIter, typename KeyOutIter>
+struct is_segments_impl<SegmentKeys<KeyIter, KeyOutIter>> : std::true_type
+{
+};
+
+/*!
+    \brief true if T describes the segments of a segmented scan
+*/
+template <typename T>
+struct is_segments : is_segments_impl<camp::decay<T>>
+{
+};
+
+/*!
+    \brief Running value of a segmented scan; head is set if a segment
+           started in the range that produced it
+*/
+template <typename Value>
+struct SegmentedCarry
+{
+  SegmentedCarry() : value(), valid(false), head(false) {}
+
+  Value value;
+  bool valid;
+  bool head;
+};
+
+/*!
+    \brief segmented scan of [lo, hi) continuing from carry, the output is
+           written only if Write is true
+
+    \return the carry out of the range
+*/
+template <bool Inclusive,
+          bool Write,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value,
+          typename diff_type>
+RAJA_INLINE SegmentedCarry<Value> segmented_scan_range(
+    const Segments& segments,
+    Iter begin,
+    OutIter out,
+    diff_type lo,
+    diff_type hi,
+    BinFn f,
+    const Value& init,
+    SegmentedCarry<Value> carry)
+{
+  for (diff_type i = lo; i < hi; ++i) {
+    const bool head = segments.is_head(i);
+    if (Inclusive) {
+      carry.value = (head || !carry.valid) ? Value(begin[i])
+                                           : f(carry.value, begin[i]);
+      if (Write) out[i] = carry.value;
+    } else {
+      const Value val = begin[i];
+      if (head) {
+        carry.value = init;
+        carry.valid = true;
+      }
+      if (Write) out[i] = carry.value;
+      carry.value = carry.valid ? f(carry.value, val) : val;
+    }
+    carry.valid = true;
+    carry.head = carry.head || head;
+  }
+  return carry;
+}
+
+/*!
+    \brief segmented scan of [begin, end) into out, each segment of an
+           exclusive scan starts from init
+
+    Each chunk is reduced, the chunk results are combined in order into the
+    value carried into each chunk, then each chunk is scanned.
+*/
+template <bool Inclusive,
+          typename Executor,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value>
+void segmented_scan(const Executor& exec,
+                    const Segments& segments,
+                    Iter begin,
+                    Iter end,
+                    OutIter out,
+                    BinFn f,
+                    const Value& init)
+{
+  using diff_type = IterDiff<Iter>;
+  using Carry = SegmentedCarry<Value>;
+
+  const diff_type n = end - begin;
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    segmented_scan_range<Inclusive, true>(
+        segments, begin, out, diff_type(0), n, f, init, Carry{});
+    return;
+  }
+
+  std::vector<Carry> carries(num_chunks);
+
+  exec(num_chunks, [&](int chunk) {
+    carries[chunk] = segmented_scan_range<Inclusive, false>(
+        segments, begin, out,
+        firstIndex(n, num_chunks, chunk),
+        firstIndex(n, num_chunks, chunk + 1),
+        f, init, Carry{});
+  });
+
+  // replace each chunk result with the value carried into the chunk
+  Carry carry;
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    const Carry chunk_carry = carries[chunk];
+    carries[chunk] = carry;
+    if (chunk_carry.head || !carry.valid) {
+      carry.value = chunk_carry.value;
+    } else {
+      carry.value = f(carry.value, chunk_carry.value);
+    }
+    carry.valid = true;
+  }
+
+  exec(num_chunks, [&](int chunk) {
+    segmented_scan_range<Inclusive, true>(
+        segments, begin, out,
+        firstIndex(n, num_chunks, chunk),
+        firstIndex(n, num_chunks, chunk + 1),
+        f, init, carries[chunk]);
+  });
+}
+
+/*!
+    \brief reduce each segment of [lo, hi) into out starting at segment
+           first_segment, the part of the range before its first head is
+           returned in lead instead
+
+    \return the number of segments that start in the range
+*/
+template <typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value,
+          typename diff_type>
+RAJA_INLINE diff_type reduce_by_key_range(const Segments& segments,
+                                          Iter begin,
+                                          OutIter out,
+                                          diff_type lo,
+                                          diff_type hi,
+                                          diff_type first_segment,
+                                          BinFn f,
+                                          SegmentedCarry<Value>& lead)
+{
+  diff_type segment = first_segment - 1;
+  SegmentedCarry<Value> acc;
+  for (diff_type i = lo; i < hi; ++i) {
+    if (segments.is_head(i)) {
+      if (segment < first_segment) {
+        lead = acc;
+      } else {
+        out[segment] = acc.value;
+      }
+      ++segment;
+      segments.write_key(segment, i);
+      acc.value = begin[i];
+    } else {
+      acc.value = acc.valid ? f(acc.value, begin[i]) : Value(begin[i]);
+    }
+    acc.valid = true;
+  }
+  if (segment < first_segment) {
+    lead = acc;
+  } else {
+    out[segment] = acc.value;
+  }
+  return segment + 1 - first_segment;
+}
+
+/*!
+    \brief reduce each segment of [begin, end) into consecutive elements of
+           out
+
+    The segments starting in each chunk are counted, then each chunk reduces
+    its segments; the part of a segment continued from an earlier chunk is
+    combined into that segment in order afterwards.
+
+    \return the number of segments
+*/
+template <typename Executor,
+          typename Segments,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+size_t reduce_by_key(const Executor& exec,
+                     const Segments& segments,
+                     Iter begin,
+                     Iter end,
+                     OutIter out,
+                     BinFn f)
+{
+  using diff_type = IterDiff<Iter>;
+  using Value = IterVal<OutIter>;
+  using Carry = SegmentedCarry<Value>;
+
+  const diff_type n = end - begin;
+  const int num_chunks = exec.num_chunks(n);
+
+  if (num_chunks <= 1) {
+    Carry lead;
+    return static_cast<size_t>(reduce_by_key_range(
+        segments, begin, out, diff_type(0), n, diff_type(0), f, lead));
+  }
+
+  std::vector<diff_type> first_segments(num_chunks + 1, diff_type(0));
+  std::vector<Carry> leads(num_chunks);
+
+  exec(num_chunks, [&](int chunk) {
+    const diff_type hi = firstIndex(n, num_chunks, chunk + 1);
+    diff_type count = 0;
+    for (diff_type i = firstIndex(n, num_chunks, chunk); i < hi; ++i) {
+      if (segments.is_head(i)) {
+        ++count;
+      }
+    }
+    first_segments[chunk + 1] = count;
+  });
+
+  for (int chunk = 0; chunk < num_chunks; ++chunk) {
+    first_segments[chunk + 1] += first_segments[chunk];
+  }
+
+  exec(num_chunks, [&](int chunk) {
+    reduce_by_key_range(segments, begin, out,
+                        firstIndex(n, num_chunks, chunk),
+                        firstIndex(n, num_chunks, chunk + 1),
+                        first_segments[chunk],
+                        f, leads[chunk]);
+  });
+
+  // the first chunk always starts with a head so it has no lead
+  for (int chunk = 1; chunk < num_chunks; ++chunk) {
+    if (leads[chunk].valid) {
+      const diff_type segment = first_segments[chunk] - 1;
+      out[segment] = f(out[segment], leads[chunk].value);
+    }
+  }
+
+  return static_cast<size_t>(first_segments[num_chunks]);
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif
@@ -20,15 +20,22 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/util/macros.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/Operators.hpp"
+
 namespace RAJA
 {
 
@@ -580,6 +587,114 @@ merge_like_std( Iter1 first1,
   return;
 }
 
+/*!
+    \brief Functional that moves a value into an existing object
+*/
+struct MergeMoveAssign
+{
+  template < typename OutIter, typename T >
+  RAJA_INLINE
+  void operator()(OutIter out, T&& val) const
+  {
+    *out = std::forward<T>(val);
+  }
+};
+
+/*!
+    \brief Functional that move constructs a value into uninitialized storage
+*/
+struct MergeMoveConstruct
+{
+  template < typename T, typename U >
+  RAJA_INLINE
+  void operator()(T* out, U&& val) const
+  {
+    new(out) T(std::forward<U>(val));
+  }
+};
+
+/*!
+    \brief find the number of elements taken from the first of two sorted
+    ranges when the first diag elements of their stable merge are produced,
+    the merge path co-rank, using O(lg(diag)) comparisons
+*/
+template <typename Iter1, typename Iter2, typename Compare>
+RAJA_INLINE
+RAJA::detail::IterDiff<Iter1>
+merge_path_split(Iter1 first1,
+                 RAJA::detail::IterDiff<Iter1> len1,
+                 Iter2 first2,
+                 RAJA::detail::IterDiff<Iter1> len2,
+                 RAJA::detail::IterDiff<Iter1> diag,
+                 Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type lo = (diag > len2) ? diag - len2 : 0;
+  diff_type hi = (diag < len1) ? diag : len1;
+
+  while ( lo < hi )
+  {
+    diff_type mid = lo + (hi - lo) / 2;
+
+    // ties are taken from the first range to keep the merge stable
+    if ( comp(first2[diag - mid - 1], first1[mid]) )
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+/*!
+    \brief stable merge of output positions [diag_begin, diag_end) of two
+    sorted ranges, given split_begin and split_end, the merge_path_split of
+    diag_begin and diag_end, values are moved to out using store so
+    independent pieces of one merge may run concurrently once the splits of
+    every piece have been found
+*/
+template <typename Iter1, typename Iter2, typename OutIter,
+          typename Compare, typename Store>
+RAJA_INLINE
+void
+merge_path_piece(Iter1 first1,
+                 Iter2 first2,
+                 OutIter out,
+                 RAJA::detail::IterDiff<Iter1> diag_begin,
+                 RAJA::detail::IterDiff<Iter1> diag_end,
+                 RAJA::detail::IterDiff<Iter1> split_begin,
+                 RAJA::detail::IterDiff<Iter1> split_end,
+                 Compare comp,
+                 Store store)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type i = split_begin;
+  diff_type j = diag_begin - split_begin;
+
+  const diff_type i_end = split_end;
+  const diff_type j_end = diag_end - split_end;
+
+  for ( diff_type k = diag_begin; k < diag_end; ++k )
+  {
+    if ( j < j_end && ( i >= i_end || comp(first2[j], first1[i]) ) )
+    {
+      store(out + k, std::move(first2[j]));
+      ++j;
+    }
+    else
+    {
+      store(out + k, std::move(first1[i]));
+      ++i;
+    }
+  }
+}
+
 /*!
     \brief stable merge sort given range inplace using comparison function
     and using O(N*lg(N)) comparisons and O(N) memory
@@ -693,6 +808,476 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief number of key bits sorted per radix sort pass
+*/
+struct radix_sort_digit_bits
+{
+  static constexpr int get() { return 8; }
+};
+
+/*!
+    \brief smallest range sorted with radix sort, shorter ranges use the
+    comparison sorts, this number is arbitrary
+*/
+struct radix_sort_min_size
+{
+  static constexpr size_t get() { return 1024; }
+};
+
+/*!
+    \brief unsigned integer type with the given number of bytes
+*/
+template <size_t bytes>
+struct radix_bits_type;
+///
+template <>
+struct radix_bits_type<1> { using type = std::uint8_t; };
+///
+template <>
+struct radix_bits_type<2> { using type = std::uint16_t; };
+///
+template <>
+struct radix_bits_type<4> { using type = std::uint32_t; };
+///
+template <>
+struct radix_bits_type<8> { using type = std::uint64_t; };
+
+/*!
+    \brief maps keys to unsigned integers with the same ordering,
+    value is true for key types that radix sort supports
+*/
+template <typename Key, typename Enable = void>
+struct radix_key_traits : std::false_type {
+};
+
+///
+template <typename Key>
+struct radix_key_traits<
+    Key,
+    typename std::enable_if<std::is_integral<Key>::value &&
+                            !std::is_same<Key, bool>::value>::type>
+    : std::true_type {
+  using bits_type = typename radix_bits_type<sizeof(Key)>::type;
+
+  static constexpr bits_type sign_bit =
+      static_cast<bits_type>(bits_type(1) << (8 * sizeof(Key) - 1));
+
+  RAJA_INLINE
+  static bits_type to_bits(Key key)
+  {
+    // flip the sign bit so negative values order before positive values
+    return std::is_signed<Key>::value
+               ? static_cast<bits_type>(static_cast<bits_type>(key) ^ sign_bit)
+               : static_cast<bits_type>(key);
+  }
+};
+
+///
+template <typename Key>
+struct radix_key_traits<
+    Key,
+    typename std::enable_if<std::is_floating_point<Key>::value &&
+                            (sizeof(Key) == 4 || sizeof(Key) == 8)>::type>
+    : std::true_type {
+  using bits_type = typename radix_bits_type<sizeof(Key)>::type;
+
+  static constexpr bits_type sign_bit =
+      static_cast<bits_type>(bits_type(1) << (8 * sizeof(Key) - 1));
+
+  RAJA_INLINE
+  static bits_type to_bits(Key key)
+  {
+    // -0.0 and 0.0 compare equal, map both to 0.0 to keep sorts stable
+    if (key == Key(0)) {
+      key = Key(0);
+    }
+
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(Key));
+
+    // reverse the order of negative values and put them before positives
+    return (bits & sign_bit) ? static_cast<bits_type>(~bits)
+                             : static_cast<bits_type>(bits | sign_bit);
+  }
+};
+
+/*!
+    \brief value is true for comparison functions that radix sort can
+    reproduce, descending is true if the comparison sorts largest first
+*/
+template <typename Key, typename Compare>
+struct radix_compare_traits : std::false_type {
+};
+
+///
+template <typename Key>
+struct radix_compare_traits<Key, operators::less<Key, Key>>
+    : std::true_type {
+  static constexpr bool descending = false;
+};
+
+///
+template <typename Key>
+struct radix_compare_traits<Key, operators::greater<Key, Key>>
+    : std::true_type {
+  static constexpr bool descending = true;
+};
+
+/*!
+    \brief value is true if the range of keys given by Iter may be sorted
+    with radix sort using Compare
+*/
+template <typename Iter, typename Compare>
+struct is_radix_sortable
+    : std::integral_constant<
+          bool,
+          radix_key_traits<IterVal<Iter>>::value &&
+              radix_compare_traits<IterVal<Iter>, Compare>::value> {
+};
+
+/*!
+    \brief extract the radix sort digit of a key at a bit offset
+*/
+template <typename Key, typename Compare>
+struct RadixDigit
+{
+  using traits = radix_key_traits<Key>;
+  using bits_type = typename traits::bits_type;
+
+  int shift;
+
+  RAJA_INLINE
+  size_t operator()(Key const& key) const
+  {
+    bits_type bits = traits::to_bits(key);
+    if (radix_compare_traits<Key, Compare>::descending) {
+      bits = static_cast<bits_type>(~bits);
+    }
+    return static_cast<size_t>(bits >> shift) &
+           ((size_t(1) << radix_sort_digit_bits::get()) - 1);
+  }
+};
+
+/*!
+    \brief placeholder for the values of a keys only radix sort,
+    reads and writes through it do nothing
+*/
+struct RadixNoValues
+{
+  struct reference
+  {
+    template <typename T>
+    RAJA_INLINE reference& operator=(T&&) { return *this; }
+  };
+
+  RAJA_INLINE reference operator*() const { return reference{}; }
+
+  template <typename diff_type>
+  RAJA_INLINE reference operator[](diff_type) const { return reference{}; }
+
+  template <typename diff_type>
+  RAJA_INLINE RadixNoValues operator+(diff_type) const { return *this; }
+};
+
+/*!
+    \brief temporary storage for the values moved by radix sort,
+    objects are constructed by the first pass that moves data
+*/
+template <typename ValIter, typename diff_type>
+class RadixValueBuffer
+{
+  using value_type = IterVal<ValIter>;
+  using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+
+  buf_deleter_type m_deleter;
+  std::unique_ptr<value_type, buf_deleter_type&> m_buf;
+
+public:
+  using construct_store = MergeMoveConstruct;
+
+  explicit RadixValueBuffer(diff_type len)
+    : m_buf(RAJA::allocate_aligned_type<value_type>(
+                RAJA::DATA_ALIGN, len * sizeof(value_type)),
+            m_deleter)
+  {
+    if (m_buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+    }
+  }
+
+  value_type* get() { return m_buf.get(); }
+
+  void set_constructed(diff_type len) { m_deleter.size = len; }
+};
+
+///
+template <typename diff_type>
+class RadixValueBuffer<RadixNoValues, diff_type>
+{
+public:
+  using construct_store = MergeMoveAssign;
+
+  explicit RadixValueBuffer(diff_type) { }
+
+  RadixNoValues get() { return RadixNoValues{}; }
+
+  void set_constructed(diff_type) { }
+};
+
+/*!
+    \brief one stable counting sort pass of radix sort from the src ranges
+    to the dst ranges, chunks of the input are processed by exec which may
+    run them concurrently. Returns false without moving anything if every
+    key has the same digit.
+*/
+template <typename Executor, typename diff_type, typename Digit,
+          typename KeySrc, typename KeyDst,
+          typename ValSrc, typename ValDst, typename Store>
+RAJA_INLINE
+bool
+radix_sort_pass(Executor const& exec,
+                int num_chunks,
+                diff_type n,
+                Digit digit,
+                diff_type* counts,
+                KeySrc key_src,
+                KeyDst key_dst,
+                ValSrc val_src,
+                ValDst val_dst,
+                Store store)
+{
+  constexpr size_t radix = size_t(1) << radix_sort_digit_bits::get();
+
+  // count the digits in each chunk
+  exec(num_chunks, [=](int chunk) {
+    diff_type* count = counts + chunk * radix;
+    for (size_t d = 0; d < radix; ++d) {
+      count[d] = 0;
+    }
+    const diff_type i_end = firstIndex(n, num_chunks, chunk + 1);
+    for (diff_type i = firstIndex(n, num_chunks, chunk); i < i_end; ++i) {
+      ++count[digit(key_src[i])];
+    }
+  });
+
+  // skip passes that would not reorder anything
+  for (size_t d = 0; d < radix; ++d) {
+    diff_type total = 0;
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      total += counts[chunk * radix + d];
+    }
+    if (total == n) {
+      return false;
+    }
+  }
+
+  // turn counts into write offsets, in digit then chunk order so equal
+  // digits keep their input order
+  diff_type offset = 0;
+  for (size_t d = 0; d < radix; ++d) {
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      diff_type count = counts[chunk * radix + d];
+      counts[chunk * radix + d] = offset;
+      offset += count;
+    }
+  }
+
+  // scatter each chunk to its offsets
+  exec(num_chunks, [=](int chunk) {
+    diff_type* offsets = counts + chunk * radix;
+    const diff_type i_end = firstIndex(n, num_chunks, chunk + 1);
+    for (diff_type i = firstIndex(n, num_chunks, chunk); i < i_end; ++i) {
+      const diff_type pos = offsets[digit(key_src[i])]++;
+      key_dst[pos] = key_src[i];
+      store(val_dst + pos, std::move(val_src[i]));
+    }
+  });
+
+  return true;
+}
+
+/*!
+    \brief stable least significant digit radix sort of keys and optional
+    values using O(N*sizeof(key)) operations and O(N) memory, chunks of
+    each pass are run by exec
+*/
+template <typename Executor, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+void
+radix_sort_impl(Executor const& exec,
+                KeyIter keys,
+                IterDiff<KeyIter> n,
+                ValIter vals,
+                Compare)
+{
+  using diff_type = IterDiff<KeyIter>;
+  using key_type = IterVal<KeyIter>;
+  using digit_type = RadixDigit<key_type, Compare>;
+  constexpr size_t radix = size_t(1) << radix_sort_digit_bits::get();
+  constexpr int key_bits = 8 * sizeof(key_type);
+
+  const int num_chunks = exec.num_chunks(n);
+
+  std::unique_ptr<key_type, FreeAligned> key_buf(
+      RAJA::allocate_aligned_type<key_type>(
+          RAJA::DATA_ALIGN, n * sizeof(key_type)));
+  std::unique_ptr<diff_type, FreeAligned> count_buf(
+      RAJA::allocate_aligned_type<diff_type>(
+          RAJA::DATA_ALIGN, num_chunks * radix * sizeof(diff_type)));
+
+  if (key_buf.get() == nullptr || count_buf.get() == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+  RadixValueBuffer<ValIter, diff_type> val_buf(n);
+
+  key_type* keys_tmp = key_buf.get();
+  diff_type* counts = count_buf.get();
+  auto vals_tmp = val_buf.get();
+
+  bool in_buf = false;
+  bool val_buf_constructed = false;
+
+  for (int shift = 0; shift < key_bits; shift += radix_sort_digit_bits::get()) {
+
+    const digit_type digit{shift};
+    bool moved;
+
+    if (in_buf) {
+      moved = radix_sort_pass(exec, num_chunks, n, digit, counts,
+                              keys_tmp, keys, vals_tmp, vals,
+                              MergeMoveAssign{});
+    } else if (val_buf_constructed) {
+      moved = radix_sort_pass(exec, num_chunks, n, digit, counts,
+                              keys, keys_tmp, vals, vals_tmp,
+                              MergeMoveAssign{});
+    } else {
+      moved = radix_sort_pass(exec, num_chunks, n, digit, counts,
+                              keys, keys_tmp, vals, vals_tmp,
+                              typename RadixValueBuffer<ValIter, diff_type>::construct_store{});
+      if (moved) {
+        val_buf_constructed = true;
+        val_buf.set_constructed(n);
+      }
+    }
+
+    if (moved) {
+      in_buf = !in_buf;
+    }
+  }
+
+  if (in_buf) {
+    // copy back after an odd number of passes
+    exec(num_chunks, [=](int chunk) {
+      const diff_type i_end = firstIndex(n, num_chunks, chunk + 1);
+      for (diff_type i = firstIndex(n, num_chunks, chunk); i < i_end; ++i) {
+        keys[i] = keys_tmp[i];
+        vals[i] = std::move(vals_tmp[i]);
+      }
+    });
+  }
+}
+
+/*!
+    \brief stable radix sort of keys using a comparison function that
+    is_radix_sortable accepts
+*/
+template <typename Executor, typename Iter, typename Compare>
+RAJA_INLINE
+void
+radix_sort(Executor const& exec,
+           Iter begin,
+           Iter end,
+           Compare comp)
+{
+  radix_sort_impl(exec, begin, end - begin, RadixNoValues{}, comp);
+}
+
+/*!
+    \brief stable radix sort of key value pairs using a comparison function
+    on keys that is_radix_sortable accepts
+*/
+template <typename Executor, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+void
+radix_sort_pairs(Executor const& exec,
+                 KeyIter keys_begin,
+                 KeyIter keys_end,
+                 ValIter vals_begin,
+                 Compare comp)
+{
+  radix_sort_impl(exec, keys_begin, keys_end - keys_begin, vals_begin, comp);
+}
+
+/*!
+    \brief sort keys with radix sort if is_radix_sortable, otherwise call
+    sorter with the same arguments
+*/
+template <typename Executor, typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<is_radix_sortable<Iter, Compare>>
+radix_sort_or(Executor const& exec,
+              Sorter&& sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  if (static_cast<size_t>(end - begin) < radix_sort_min_size::get()) {
+    sorter(begin, end, comp);
+  } else {
+    radix_sort(exec, begin, end, comp);
+  }
+}
+///
+template <typename Executor, typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<is_radix_sortable<Iter, Compare>>>
+radix_sort_or(Executor const&,
+              Sorter&& sorter,
+              Iter begin,
+              Iter end,
+              Compare comp)
+{
+  sorter(begin, end, comp);
+}
+
+/*!
+    \brief sort key value pairs with radix sort if is_radix_sortable,
+    otherwise call sorter with the same arguments
+*/
+template <typename Executor, typename Sorter,
+          typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<is_radix_sortable<KeyIter, Compare>>
+radix_sort_pairs_or(Executor const& exec,
+                    Sorter&& sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  if (static_cast<size_t>(keys_end - keys_begin) < radix_sort_min_size::get()) {
+    sorter(keys_begin, keys_end, vals_begin, comp);
+  } else {
+    radix_sort_pairs(exec, keys_begin, keys_end, vals_begin, comp);
+  }
+}
+///
+template <typename Executor, typename Sorter,
+          typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<is_radix_sortable<KeyIter, Compare>>>
+radix_sort_pairs_or(Executor const&,
+                    Sorter&& sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  sorter(keys_begin, keys_end, vals_begin, comp);
+}
+
 }  // namespace detail
 
 /*!
@@ -0,0 +1,275 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/KernelTuner.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+
+namespace
+{
+
+const char* const cache_header = "# RAJA tuning cache 1";
+
+std::vector<std::string> split(const std::string& line, char delim)
+{
+  std::vector<std::string> fields;
+  std::string field;
+  std::istringstream is(line);
+  while (std::getline(is, field, delim)) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+long long parseInteger(const std::string& s)
+{
+  char* end = nullptr;
+  const long long value = std::strtoll(s.c_str(), &end, 10);
+  if (s.empty() || *end != '\0') {
+    RAJA_ABORT_OR_THROW("Malformed integer in RAJA tuning cache file");
+  }
+  return value;
+}
+
+}  // namespace
+
+TuningCache& TuningCache::get_default()
+{
+  static TuningCache* cache = []() {
+    // never destroyed so the cache outlives static tuners that use it
+    TuningCache* c = new TuningCache();
+    const char* path = std::getenv("RAJA_TUNING_CACHE");
+    if (path && *path) {
+      c->load(path);
+    }
+    return c;
+  }();
+  return *cache;
+}
+
+bool TuningCache::find(const std::string& name,
+                       Index_type problem_size,
+                       TuningConfig& config) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entries.find(std::make_pair(name, problem_size));
+  if (it == entries.end()) {
+    return false;
+  }
+  config = it->second.config;
+  return true;
+}
+
+void TuningCache::insert(const std::string& name,
+                         Index_type problem_size,
+                         const TuningConfig& config,
+                         double seconds)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  entries[std::make_pair(name, problem_size)] = Entry{config, seconds};
+}
+
+std::size_t TuningCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return entries.size();
+}
+
+void TuningCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+}
+
+bool TuningCache::save(const std::string& path) const
+{
+  std::ofstream os(path);
+  if (!os) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  os << cache_header << "\n";
+  os << "# name\tproblem size\tschedule\tchunk size\ttile sizes\tseconds\n";
+  for (const auto& e : entries) {
+    const TuningConfig& config = e.second.config;
+    os << e.first.first << '\t' << e.first.second << '\t'
+       << static_cast<int>(config.schedule) << '\t' << config.chunk_size
+       << '\t';
+    if (config.tile_sizes.empty()) {
+      os << '-';
+    }
+    for (std::size_t i = 0; i < config.tile_sizes.size(); ++i) {
+      os << (i ? "," : "") << config.tile_sizes[i];
+    }
+    os << '\t' << e.second.seconds << "\n";
+  }
+  return static_cast<bool>(os);
+}
+
+bool TuningCache::load(const std::string& path)
+{
+  std::ifstream is(path);
+  if (!is) {
+    return false;
+  }
+
+  std::string line;
+  if (!std::getline(is, line) || line != cache_header) {
+    RAJA_ABORT_OR_THROW("File is not a RAJA tuning cache");
+  }
+
+  while (std::getline(is, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    const std::vector<std::string> fields = split(line, '\t');
+    if (fields.size() != 6) {
+      RAJA_ABORT_OR_THROW("Malformed line in RAJA tuning cache file");
+    }
+
+    TuningConfig config;
+    const long long schedule = parseInteger(fields[2]);
+    if (schedule < static_cast<int>(TuningSchedule::Default) ||
+        schedule > static_cast<int>(TuningSchedule::Auto)) {
+      RAJA_ABORT_OR_THROW("Unknown schedule in RAJA tuning cache file");
+    }
+    config.schedule = static_cast<TuningSchedule>(schedule);
+    config.chunk_size = static_cast<int>(parseInteger(fields[3]));
+    if (fields[4] != "-") {
+      for (const std::string& tile : split(fields[4], ',')) {
+        config.tile_sizes.push_back(static_cast<camp::idx_t>(parseInteger(tile)));
+      }
+    }
+
+    insert(fields[0],
+           static_cast<Index_type>(parseInteger(fields[1])),
+           config,
+           std::atof(fields[5].c_str()));
+  }
+  return true;
+}
+
+TuningScheduleGuard::TuningScheduleGuard(const TuningConfig& config)
+    : active(false), prev_schedule(0), prev_chunk(0)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  if (config.schedule != TuningSchedule::Default) {
+    omp_sched_t sched;
+    omp_get_schedule(&sched, &prev_chunk);
+    prev_schedule = static_cast<int>(sched);
+    omp_set_schedule(static_cast<omp_sched_t>(config.schedule),
+                     config.chunk_size);
+    active = true;
+  }
+#else
+  RAJA_UNUSED_VAR(config);
+#endif
+}
+
+TuningScheduleGuard::~TuningScheduleGuard()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  if (active) {
+    omp_set_schedule(static_cast<omp_sched_t>(prev_schedule), prev_chunk);
+  }
+#endif
+}
+
+KernelTuner::KernelTuner(std::string name_,
+                         std::vector<TuningConfig> candidates_,
+                         int samples_,
+                         TuningCache& cache_)
+    : name(std::move(name_)),
+      candidates(std::move(candidates_)),
+      samples(samples_ > 0 ? static_cast<std::size_t>(samples_) : 0),
+      cache(&cache_)
+{
+  if (candidates.empty()) {
+    RAJA_ABORT_OR_THROW("KernelTuner needs at least one candidate");
+  }
+  if (samples == 0) {
+    RAJA_ABORT_OR_THROW("KernelTuner needs at least one sample per candidate");
+  }
+}
+
+KernelTuner::State& KernelTuner::get_state(Index_type problem_size)
+{
+  auto it = states.find(problem_size);
+  if (it != states.end()) {
+    return it->second;
+  }
+
+  State& state = states[problem_size];
+  if (cache->find(name, problem_size, state.best)) {
+    state.tuned = true;
+  } else if (candidates.size() == 1) {
+    state.tuned = true;
+    state.best = candidates[0];
+  } else {
+    state.min_seconds.assign(candidates.size(), -1.0);
+  }
+  return state;
+}
+
+void KernelTuner::record(Index_type problem_size,
+                         State& state,
+                         std::size_t candidate,
+                         double seconds)
+{
+  double& min_seconds = state.min_seconds[candidate];
+  if (min_seconds < 0.0 || seconds < min_seconds) {
+    min_seconds = seconds;
+  }
+
+  if (++state.next < candidates.size() * samples) {
+    return;
+  }
+
+  const std::size_t best =
+      std::min_element(state.min_seconds.begin(), state.min_seconds.end()) -
+      state.min_seconds.begin();
+  state.tuned = true;
+  state.best = candidates[best];
+  cache->insert(name, problem_size, state.best, state.min_seconds[best]);
+}
+
+bool KernelTuner::is_tuned(Index_type problem_size) const
+{
+  auto it = states.find(problem_size);
+  if (it != states.end()) {
+    return it->second.tuned;
+  }
+  TuningConfig config;
+  return cache->find(name, problem_size, config);
+}
+
+const TuningConfig& KernelTuner::get_config(Index_type problem_size)
+{
+  State& state = get_state(problem_size);
+  if (state.tuned) {
+    return state.best;
+  }
+  return candidates[state.next / samples];
+}
+
+}  // namespace expt
+}  // namespace RAJA
@@ -61,7 +61,7 @@ void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.kernel_name ? p.kernel_name : p.policy_name, 0, &(p.kID));
   }
 }
 
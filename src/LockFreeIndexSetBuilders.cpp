@@ -15,11 +15,14 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
 #include <iostream>
+#include <numeric>
+#include <vector>
 
 #include "RAJA/index/IndexSetBuilders.hpp"
 
@@ -107,85 +110,47 @@ void buildLockFreeBlockIndexset(
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
+    /* Need at least 2 full planes per thread */
     /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::Index_type startPlane = i * slowDim / numThreads;
-              RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
-              RAJA::Index_type start = startPlane * fastDim * midDim;
-              RAJA::Index_type end = endPlane * fastDim * midDim;
-              RAJA::Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
+    const int segmentsPerThread = 2;
+    int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
+    if (rowsPerSegment == 0) {
+      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
+      iset.initDependencyGraph();
+    } else {
+      /* Lane 0 holds the lower half of the planes of each thread */
+      /* and lane 1 the upper half */
+      for (int lane = 0; lane < segmentsPerThread; ++lane) {
+        for (int i = 0; i < numThreads; ++i) {
+          RAJA::Index_type startPlane = i * slowDim / numThreads;
+          RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
+          RAJA::Index_type start = startPlane * fastDim * midDim;
+          RAJA::Index_type end = endPlane * fastDim * midDim;
+          RAJA::Index_type len = end - start;
+          iset.push_back(
+              RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
+                                 start + (lane + 1) * len /
+                                             segmentsPerThread));
+        }
+      }
 
-          iset.finalizeDependencyGraph();
+      /* Allocate dependency graph structures for index set segments */
+      iset.initDependencyGraph();
+
+      /* The upper half of a block may not run until the lower halves */
+      /* of its own block and of the block above it have completed, */
+      /* so halves sharing a block boundary never run concurrently */
+      int borderSeg = numThreads * (segmentsPerThread - 1);
+      for (int i = 0; i < numThreads; ++i) {
+        RAJA::DepGraphNode* task = iset.getDepGraphNode(i);
+        task->addDepTask(borderSeg + i);
+        if (i > 0) {
+          task->addDepTask(borderSeg + i - 1);
         }
-    */
+      }
+    }
+
+    iset.finalizeDependencyGraph();
   }
 
   /* Print the dependency schedule for segments */
@@ -330,4 +295,323 @@ void buildLockFreeColorIndexset(
   delete[] workset;
 }
 
+namespace
+{
+
+int loadColor(int* color, RAJA::Index_type block)
+{
+  int c;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic read
+#endif
+  c = color[block];
+  return c;
+}
+
+void storeColor(int* color, RAJA::Index_type block, int c)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic write
+#endif
+  color[block] = c;
+}
+
+//
+// Conflict graph of blocks of blockSize consecutive domain entities. Two
+// blocks are neighbors if entities of both share a range entity.
+//
+struct ColorBlockGraph {
+  RAJA::Index_type const* domainOffsets;
+  RAJA::Index_type const* domainToRange;
+  RAJA::Index_type const* rangeOffsets;
+  RAJA::Index_type const* rangeToDomain;
+  RAJA::Index_type numEntity;
+  RAJA::Index_type blockSize;
+
+  template <typename Func>
+  void forNeighbors(RAJA::Index_type block, Func&& func) const
+  {
+    const RAJA::Index_type first = block * blockSize;
+    const RAJA::Index_type last = std::min(first + blockSize, numEntity);
+    for (RAJA::Index_type e = first; e < last; ++e) {
+      for (RAJA::Index_type j = domainOffsets[e]; j < domainOffsets[e + 1];
+           ++j) {
+        const RAJA::Index_type r = domainToRange[j];
+        for (RAJA::Index_type k = rangeOffsets[r]; k < rangeOffsets[r + 1];
+             ++k) {
+          const RAJA::Index_type nb = rangeToDomain[k] / blockSize;
+          if (nb != block) {
+            func(nb);
+          }
+        }
+      }
+    }
+  }
+};
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate a lock-free "color" index set from CSR connectivity by parallel
+ * speculative greedy coloring with conflict repair.
+ *
+ ******************************************************************************
+ */
+void buildLockFreeColorIndexsetCSR(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainOffsets,
+    RAJA::Index_type const* domainToRange,
+    RAJA::Index_type numEntity,
+    RAJA::Index_type numEntityRange,
+    RAJA::Index_type blockSize)
+{
+  if (numEntity <= 0) return;
+
+  blockSize = std::max(blockSize, RAJA::Index_type(1));
+  const RAJA::Index_type numBlock = (numEntity + blockSize - 1) / blockSize;
+  const int numThreads = getMaxOMPThreadsCPU();
+
+  /* create an inverse mapping */
+  std::vector<RAJA::Index_type> rangeOffsets(numEntityRange + 1, 0);
+  std::vector<RAJA::Index_type> rangeToDomain(domainOffsets[numEntity]);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type i = 0; i < numEntity; ++i) {
+    for (RAJA::Index_type j = domainOffsets[i]; j < domainOffsets[i + 1]; ++j) {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic
+#endif
+      ++rangeOffsets[domainToRange[j] + 1];
+    }
+  }
+
+  std::partial_sum(rangeOffsets.begin(), rangeOffsets.end(),
+                   rangeOffsets.begin());
+  std::vector<RAJA::Index_type> rangeFill(rangeOffsets.begin(),
+                                          rangeOffsets.end() - 1);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type i = 0; i < numEntity; ++i) {
+    for (RAJA::Index_type j = domainOffsets[i]; j < domainOffsets[i + 1]; ++j) {
+      RAJA::Index_type pos;
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp atomic capture
+#endif
+      pos = rangeFill[domainToRange[j]]++;
+      rangeToDomain[pos] = i;
+    }
+  }
+
+  const ColorBlockGraph graph{domainOffsets,
+                              domainToRange,
+                              rangeOffsets.data(),
+                              rangeToDomain.data(),
+                              numEntity,
+                              blockSize};
+
+  /*
+   * Color blocks speculatively in parallel, each with the smallest color
+   * not used by its neighbors, then recolor the larger block of each pair
+   * of neighbors that picked the same color, until no conflicts remain.
+   */
+  std::vector<int> color(numBlock, -1);
+  int* colorData = color.data();
+
+  std::vector<RAJA::Index_type> workset(numBlock);
+  std::iota(workset.begin(), workset.end(), RAJA::Index_type(0));
+
+  std::vector<std::vector<RAJA::Index_type>> redo(numThreads);
+
+  while (!workset.empty()) {
+    const RAJA::Index_type worksetSize =
+        static_cast<RAJA::Index_type>(workset.size());
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      // forbidden[c] == b marks color c as used by a neighbor of block b
+      std::vector<RAJA::Index_type> forbidden;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for (RAJA::Index_type w = 0; w < worksetSize; ++w) {
+        const RAJA::Index_type b = workset[w];
+        graph.forNeighbors(b, [&](RAJA::Index_type nb) {
+          const int c = loadColor(colorData, nb);
+          if (c >= 0) {
+            if (static_cast<size_t>(c) >= forbidden.size()) {
+              forbidden.resize(c + 1, -1);
+            }
+            forbidden[c] = b;
+          }
+        });
+        int c = 0;
+        while (static_cast<size_t>(c) < forbidden.size() && forbidden[c] == b) {
+          ++c;
+        }
+        storeColor(colorData, b, c);
+      }
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel
+#endif
+    {
+      int tid = 0;
+#if defined(RAJA_ENABLE_OPENMP)
+      tid = omp_get_thread_num();
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for (RAJA::Index_type w = 0; w < worksetSize; ++w) {
+        const RAJA::Index_type b = workset[w];
+        const int c = colorData[b];
+        bool conflict = false;
+        graph.forNeighbors(b, [&](RAJA::Index_type nb) {
+          conflict = conflict || (nb < b && colorData[nb] == c);
+        });
+        if (conflict) {
+          redo[tid].push_back(b);
+        }
+      }
+    }
+
+    workset.clear();
+    for (auto& r : redo) {
+      workset.insert(workset.end(), r.begin(), r.end());
+      r.clear();
+    }
+    std::sort(workset.begin(), workset.end());
+  }
+
+  /*
+   * Entities of one block share a block color but may share range entities,
+   * so split each block by a greedy coloring of its own entities. An entity
+   * gets color blockColor * numLocalColor + localColor, which no other
+   * entity it shares a range entity with can have.
+   */
+  std::vector<int> localColor(numEntity, 0);
+  int numLocalColor = 1;
+
+  if (blockSize > 1) {
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel reduction(max : numLocalColor)
+#endif
+    {
+      // forbidden[c] == e marks local color c as used by a neighbor of e
+      std::vector<RAJA::Index_type> forbidden;
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for (RAJA::Index_type b = 0; b < numBlock; ++b) {
+        const RAJA::Index_type first = b * blockSize;
+        const RAJA::Index_type last = std::min(first + blockSize, numEntity);
+        for (RAJA::Index_type e = first; e < last; ++e) {
+          for (RAJA::Index_type j = domainOffsets[e]; j < domainOffsets[e + 1];
+               ++j) {
+            const RAJA::Index_type r = domainToRange[j];
+            for (RAJA::Index_type k = rangeOffsets[r]; k < rangeOffsets[r + 1];
+                 ++k) {
+              const RAJA::Index_type d = rangeToDomain[k];
+              if (d >= first && d < e) {
+                const int c = localColor[d];
+                if (static_cast<size_t>(c) >= forbidden.size()) {
+                  forbidden.resize(c + 1, -1);
+                }
+                forbidden[c] = e;
+              }
+            }
+          }
+          int c = 0;
+          while (static_cast<size_t>(c) < forbidden.size() &&
+                 forbidden[c] == e) {
+            ++c;
+          }
+          localColor[e] = c;
+          numLocalColor = std::max(numLocalColor, c + 1);
+        }
+      }
+    }
+  }
+
+  std::vector<int> entityColor(numEntity);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (RAJA::Index_type i = 0; i < numEntity; ++i) {
+    entityColor[i] = color[i / blockSize] * numLocalColor + localColor[i];
+  }
+
+  /* gather the entities of each color in ascending order */
+  const int numColor =
+      *std::max_element(entityColor.begin(), entityColor.end()) + 1;
+
+  std::vector<RAJA::Index_type> counts(
+      static_cast<size_t>(numThreads) * numColor, 0);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int t = 0; t < numThreads; ++t) {
+    const RAJA::Index_type first = (numEntity * t) / numThreads;
+    const RAJA::Index_type last = (numEntity * (t + 1)) / numThreads;
+    for (RAJA::Index_type i = first; i < last; ++i) {
+      ++counts[t * numColor + entityColor[i]];
+    }
+  }
+
+  std::vector<RAJA::Index_type> colorDelim(numColor + 1);
+  RAJA::Index_type pos = 0;
+  for (int c = 0; c < numColor; ++c) {
+    colorDelim[c] = pos;
+    for (int t = 0; t < numThreads; ++t) {
+      const RAJA::Index_type n = counts[t * numColor + c];
+      counts[t * numColor + c] = pos;
+      pos += n;
+    }
+  }
+  colorDelim[numColor] = pos;
+
+  std::vector<RAJA::Index_type> colorEntity(numEntity);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int t = 0; t < numThreads; ++t) {
+    const RAJA::Index_type first = (numEntity * t) / numThreads;
+    const RAJA::Index_type last = (numEntity * (t + 1)) / numThreads;
+    for (RAJA::Index_type i = first; i < last; ++i) {
+      colorEntity[counts[t * numColor + entityColor[i]]++] = i;
+    }
+  }
+
+  for (int c = 0; c < numColor; ++c) {
+    const RAJA::Index_type begin = colorDelim[c];
+    const RAJA::Index_type end = colorDelim[c + 1];
+    if (begin == end) {
+      continue;
+    }
+    if (colorEntity[end - 1] - colorEntity[begin] + 1 == end - begin) {
+      iset.push_back(
+          RAJA::RangeSegment(colorEntity[begin], colorEntity[end - 1] + 1));
+    } else {
+      iset.push_back(RAJA::ListSegment(&colorEntity[begin], end - begin,
+                                       work_res));
+    }
+  }
+}
+
 }  // namespace RAJA
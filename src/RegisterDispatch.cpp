@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/policy/tensor/dispatch.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define RAJA_REGISTER_DISPATCH_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace RAJA
+{
+namespace expt
+{
+
+namespace
+{
+
+#if defined(RAJA_REGISTER_DISPATCH_X86)
+
+bool cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+{
+#if defined(_MSC_VER)
+  int max[4];
+  __cpuid(max, static_cast<int>(leaf & 0x80000000u));
+  if (static_cast<unsigned>(max[0]) < leaf) {
+    return false;
+  }
+  int r[4];
+  __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int i = 0; i < 4; ++i) {
+    regs[i] = static_cast<unsigned>(r[i]);
+  }
+  return true;
+#else
+  return __get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3])
+         != 0;
+#endif
+}
+
+// Register state the OS saves on context switches
+unsigned long long xgetbv()
+{
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+register_isa detect_register_isa()
+{
+  unsigned regs[4];
+  if (!cpuid(1, 0, regs)) {
+    return register_isa::scalar;
+  }
+  const unsigned ecx1 = regs[2];
+  const bool osxsave = ecx1 & (1u << 27);
+  const bool avx = ecx1 & (1u << 28);
+  const bool fma = ecx1 & (1u << 12);
+  if (!osxsave || !avx) {
+    return register_isa::scalar;
+  }
+
+  const unsigned long long xcr0 = xgetbv();
+  // XMM and YMM state
+  if ((xcr0 & 0x6) != 0x6) {
+    return register_isa::scalar;
+  }
+
+  unsigned ebx7 = 0;
+  if (cpuid(7, 0, regs)) {
+    ebx7 = regs[1];
+  }
+  // avx2_register uses FMA instructions when they are enabled
+  if (!(ebx7 & (1u << 5)) || !fma) {
+    return register_isa::avx;
+  }
+  // opmask, upper ZMM and ZMM16-31 state
+  if (!(ebx7 & (1u << 16)) || (xcr0 & 0xe0) != 0xe0) {
+    return register_isa::avx2;
+  }
+  return register_isa::avx512;
+}
+
+#else
+
+register_isa detect_register_isa() { return register_isa::scalar; }
+
+#endif
+
+register_isa parse_register_isa(const char* name)
+{
+  for (int i = 0; i < num_register_isas; ++i) {
+    const register_isa isa = static_cast<register_isa>(i);
+    if (std::strcmp(name, get_register_isa_name(isa)) == 0) {
+      return isa;
+    }
+  }
+  RAJA_ABORT_OR_THROW("Unknown register ISA in RAJA_REGISTER_ISA");
+  return register_isa::scalar;
+}
+
+}  // namespace
+
+register_isa get_cpu_register_isa()
+{
+  static const register_isa isa = []() {
+    register_isa detected = detect_register_isa();
+    const char* env = std::getenv("RAJA_REGISTER_ISA");
+    if (env && *env) {
+      const register_isa requested = parse_register_isa(env);
+      if (requested < detected) {
+        detected = requested;
+      }
+    }
+    return detected;
+  }();
+  return isa;
+}
+
+const char* get_register_isa_name(register_isa isa)
+{
+  switch (isa) {
+    case register_isa::scalar:
+      return "scalar";
+    case register_isa::avx:
+      return "avx";
+    case register_isa::avx2:
+      return "avx2";
+    case register_isa::avx512:
+      return "avx512";
+  }
+  return "unknown";
+}
+
+}  // namespace expt
+}  // namespace RAJA
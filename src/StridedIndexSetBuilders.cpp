@@ -0,0 +1,336 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the parallel strided index set builder.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include "camp/resource.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+//
+// Minimum number of indices scanned by each thread, and maximum number
+// copied by each task of the list data gather.
+//
+const RAJA::Index_type strided_chunk_min_length = 1 << 14;
+const RAJA::Index_type strided_copy_length = 1 << 16;
+
+//
+// A run of input positions [begin, begin + length). A list run holds
+// indices with no usable stride; any other run holds indices that step by
+// stride, where a stride of 0 means the run has a single index or repeats
+// an index and cannot become a range.
+//
+struct StridedRun {
+  RAJA::Index_type begin;
+  RAJA::Index_type length;
+  RAJA::Index_type stride;
+  bool list;
+};
+
+//
+// Copy of length list indices from input position src to list data offset dst.
+//
+struct StridedListCopy {
+  RAJA::Index_type src;
+  RAJA::Index_type dst;
+  RAJA::Index_type length;
+};
+
+void appendListRun(std::vector<StridedRun>& runs,
+                   RAJA::Index_type begin,
+                   RAJA::Index_type length)
+{
+  if (!runs.empty() && runs.back().list) {
+    runs.back().length += length;
+  } else {
+    runs.push_back(StridedRun{begin, length, 0, true});
+  }
+}
+
+//
+// Split indices [chunk_begin, chunk_end) into maximal constant-stride runs.
+// Runs shorter than range_min_length are folded into list runs, except the
+// first and last run of the chunk, which are kept so that runs crossing a
+// chunk boundary can be merged.
+//
+void scanStridedRuns(const RAJA::Index_type* const indices_in,
+                     RAJA::Index_type chunk_begin,
+                     RAJA::Index_type chunk_end,
+                     RAJA::Index_type range_min_length,
+                     std::vector<StridedRun>& runs)
+{
+  bool have_pending = false;
+  StridedRun pending{0, 0, 0, false};
+
+  RAJA::Index_type ii = chunk_begin;
+  while (ii < chunk_end) {
+    StridedRun run{ii, 1, 0, false};
+    if (ii + 1 < chunk_end) {
+      run.stride = indices_in[ii + 1] - indices_in[ii];
+      run.length = 2;
+      while (ii + run.length < chunk_end &&
+             indices_in[ii + run.length] - indices_in[ii + run.length - 1] ==
+                 run.stride) {
+        ++run.length;
+      }
+    }
+
+    // a short run gives up its last index, which may start a longer run
+    if (run.length > 1 && ii + run.length < chunk_end &&
+        (run.stride == 0 || run.length < range_min_length)) {
+      --run.length;
+      if (run.length == 1) {
+        run.stride = 0;
+      }
+    }
+
+    if (have_pending) {
+      if (pending.begin != chunk_begin &&
+          (pending.stride == 0 || pending.length < range_min_length)) {
+        appendListRun(runs, pending.begin, pending.length);
+      } else {
+        runs.push_back(pending);
+      }
+    }
+    pending = run;
+    have_pending = true;
+    ii += run.length;
+  }
+
+  if (have_pending) {
+    runs.push_back(pending);
+  }
+}
+
+//
+// Merge run b, which starts a chunk, into run a, which ends the previous
+// chunk, when the indices of both continue a single stride.
+//
+bool mergeStridedRuns(const RAJA::Index_type* const indices_in,
+                      StridedRun& a,
+                      const StridedRun& b)
+{
+  if (a.list || b.list) {
+    return false;
+  }
+  const RAJA::Index_type gap =
+      indices_in[b.begin] - indices_in[a.begin + a.length - 1];
+  if (gap == 0) {
+    return false;
+  }
+  if ((a.length == 1 || a.stride == gap) &&
+      (b.length == 1 || b.stride == gap)) {
+    a.length += b.length;
+    a.stride = gap;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with Range, RangeStride and List segments from
+ * given array of indices, scanning the array in parallel.
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type* buildIndexSetStrided(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length)
+{
+  const int num_chunks = static_cast<int>(std::max(
+      RAJA::Index_type(1),
+      std::min(static_cast<RAJA::Index_type>(getMaxOMPThreadsCPU()),
+               length / strided_chunk_min_length)));
+
+  return detail::buildIndexSetStrided(
+      iset, work_res, indices_in, length, range_min_length, num_chunks);
+}
+
+namespace detail
+{
+
+/*
+ ******************************************************************************
+ *
+ * Generate an index set with Range, RangeStride and List segments from
+ * given array of indices, scanning the array in num_chunks parts.
+ *
+ ******************************************************************************
+ */
+RAJA::Index_type* buildIndexSetStrided(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::RangeStrideSegment,
+                        RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    int num_chunks)
+{
+  if (length == 0) return nullptr;
+
+  range_min_length = std::max(range_min_length, RAJA::Index_type(2));
+
+  /*******************************************/
+  /* first, find the runs of each chunk      */
+  /*******************************************/
+
+  num_chunks = static_cast<int>(std::max(
+      RAJA::Index_type(1),
+      std::min(static_cast<RAJA::Index_type>(num_chunks), length)));
+
+  std::vector<std::vector<StridedRun>> chunk_runs(num_chunks);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static, 1)
+#endif
+  for (int c = 0; c < num_chunks; ++c) {
+    const RAJA::Index_type chunk_begin = (length * c) / num_chunks;
+    const RAJA::Index_type chunk_end = (length * (c + 1)) / num_chunks;
+    scanStridedRuns(
+        indices_in, chunk_begin, chunk_end, range_min_length, chunk_runs[c]);
+  }
+
+  /*******************************************/
+  /* merge runs across chunk boundaries and  */
+  /* fold short runs into list runs          */
+  /*******************************************/
+
+  std::vector<StridedRun> merged;
+  for (int c = 0; c < num_chunks; ++c) {
+    for (size_t r = 0; r < chunk_runs[c].size(); ++r) {
+      const StridedRun& run = chunk_runs[c][r];
+      if (r == 0 && !merged.empty() &&
+          mergeStridedRuns(indices_in, merged.back(), run)) {
+        continue;
+      }
+      merged.push_back(run);
+    }
+    std::vector<StridedRun>().swap(chunk_runs[c]);
+  }
+
+  std::vector<StridedRun> runs;
+  runs.reserve(merged.size());
+  RAJA::Index_type list_length = 0;
+  for (const StridedRun& run : merged) {
+    if (run.list || run.stride == 0 || run.length < range_min_length) {
+      appendListRun(runs, run.begin, run.length);
+      list_length += run.length;
+    } else {
+      runs.push_back(run);
+    }
+  }
+
+  /*******************************************/
+  /* gather all list indices into one        */
+  /* allocation in the work resource         */
+  /*******************************************/
+
+  RAJA::Index_type* list_data = nullptr;
+  if (list_length > 0) {
+    list_data = work_res.allocate<RAJA::Index_type>(list_length);
+
+    const bool on_host =
+        work_res.get_platform() == camp::resources::Platform::host;
+    camp::resources::Resource host_res{camp::resources::Host()};
+    RAJA::Index_type* host_data =
+        on_host ? list_data : host_res.allocate<RAJA::Index_type>(list_length);
+
+    // split long lists so the copy is spread over threads
+    std::vector<StridedListCopy> copies;
+    RAJA::Index_type offset = 0;
+    for (const StridedRun& run : runs) {
+      if (!run.list) continue;
+      for (RAJA::Index_type ii = 0; ii < run.length;
+           ii += strided_copy_length) {
+        const RAJA::Index_type len =
+            std::min(strided_copy_length, run.length - ii);
+        copies.push_back(StridedListCopy{run.begin + ii, offset + ii, len});
+      }
+      offset += run.length;
+    }
+
+    const RAJA::Index_type num_copies =
+        static_cast<RAJA::Index_type>(copies.size());
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (RAJA::Index_type cp = 0; cp < num_copies; ++cp) {
+      std::memcpy(&host_data[copies[cp].dst],
+                  &indices_in[copies[cp].src],
+                  sizeof(RAJA::Index_type) * copies[cp].length);
+    }
+
+    if (!on_host) {
+      work_res.memcpy(list_data,
+                      host_data,
+                      sizeof(RAJA::Index_type) * list_length);
+      work_res.wait();
+      host_res.deallocate(host_data);
+    }
+  }
+
+  /*******************************************/
+  /* now, build the index set                */
+  /*******************************************/
+
+  RAJA::Index_type offset = 0;
+  for (const StridedRun& run : runs) {
+    if (run.list) {
+      iset.push_back(ListSegment(
+          &list_data[offset], run.length, work_res, Unowned));
+      offset += run.length;
+    } else {
+      const RAJA::Index_type first = indices_in[run.begin];
+      if (run.stride == 1) {
+        iset.push_back(RangeSegment(first, first + run.length));
+      } else {
+        iset.push_back(RangeStrideSegment(
+            first, first + run.length * run.stride, run.stride));
+      }
+    }
+  }
+
+  return list_data;
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
@@ -0,0 +1,374 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+const std::size_t default_max_events = 1000000;
+
+std::atomic<std::size_t> next_plugin_id{1};
+
+struct PointerPairHash {
+  std::size_t operator()(const std::pair<const char*, const char*>& p) const
+  {
+    const std::size_t h = std::hash<const char*>()(p.first);
+    return h ^ (std::hash<const char*>()(p.second) + 0x9e3779b9 + (h << 6) +
+                (h >> 2));
+  }
+};
+
+const char* platformName(Platform p)
+{
+  switch (p) {
+    case Platform::host:
+      return "host";
+    case Platform::cuda:
+      return "cuda";
+    case Platform::hip:
+      return "hip";
+    case Platform::omp_target:
+      return "omp_target";
+    default:
+      return "unknown";
+  }
+}
+
+void writeJsonString(std::ostream& os, const std::string& s)
+{
+  os << '"';
+  for (const char c : s) {
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buf[8];
+          std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<int>(c));
+          os << buf;
+        } else {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+}  // end anonymous namespace
+
+struct TracePlugin::ThreadData {
+  struct Event {
+    std::size_t stats;
+    double start_us;
+    double duration_us;
+    Index_type iterations;
+  };
+
+  explicit ThreadData(std::size_t thread_id) : tid(thread_id) {}
+
+  //! Index of the statistics of a launch, adding them on first use
+  std::size_t lookup(const PluginContext& p)
+  {
+    const char* name = p.kernel_name ? p.kernel_name : p.policy_name;
+    const auto key = std::make_pair(name, p.policy_name);
+
+    // the pointers are checked against the strings in case a name buffer
+    // was reused for a different name
+    auto it = by_pointer.find(key);
+    if (it != by_pointer.end() &&
+        std::strcmp(stats[it->second].name.c_str(), name) == 0 &&
+        std::strcmp(stats[it->second].policy.c_str(), p.policy_name) == 0) {
+      return it->second;
+    }
+
+    const auto content = std::make_pair(std::string(name),
+                                        std::string(p.policy_name));
+    auto cit = by_content.find(content);
+    std::size_t index;
+    if (cit != by_content.end()) {
+      index = cit->second;
+    } else {
+      index = stats.size();
+      stats.push_back(KernelStats{content.first,
+                                  content.second,
+                                  p.platform,
+                                  0,
+                                  0.0,
+                                  0.0,
+                                  0.0,
+                                  0});
+      by_content.emplace(content, index);
+    }
+    by_pointer[key] = index;
+    return index;
+  }
+
+  const std::size_t tid;
+
+  std::vector<clock_type::time_point> starts;
+
+  std::vector<KernelStats> stats;
+  std::unordered_map<std::pair<const char*, const char*>,
+                     std::size_t,
+                     PointerPairHash>
+      by_pointer;
+  std::map<std::pair<std::string, std::string>, std::size_t> by_content;
+
+  std::vector<Event> events;
+  std::size_t dropped = 0;
+};
+
+TracePlugin::TracePlugin()
+    : id(next_plugin_id.fetch_add(1)),
+      start(clock_type::now()),
+      max_events(default_max_events),
+      num_events(0)
+{
+  const char* max_env = std::getenv("RAJA_TRACE_MAX_EVENTS");
+  if (max_env && *max_env) {
+    max_events = static_cast<std::size_t>(std::strtoull(max_env, nullptr, 10));
+  }
+}
+
+TracePlugin::~TracePlugin() = default;
+
+TracePlugin::ThreadData& TracePlugin::getThreadData()
+{
+  // buffers of this thread for each plugin it has seen, keyed by the plugin
+  // id as a destroyed plugin's address may be reused
+  static thread_local std::vector<std::pair<std::size_t, ThreadData*>> slots;
+
+  for (const auto& slot : slots) {
+    if (slot.first == id) {
+      return *slot.second;
+    }
+  }
+
+  ThreadData* data;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.emplace_back(new ThreadData(threads.size()));
+    data = threads.back().get();
+  }
+  slots.emplace_back(id, data);
+  return *data;
+}
+
+void TracePlugin::preLaunch(const PluginContext&)
+{
+  ThreadData& data = getThreadData();
+  data.starts.push_back(clock_type::now());
+}
+
+void TracePlugin::postLaunch(const PluginContext& p)
+{
+  const clock_type::time_point stop = clock_type::now();
+
+  ThreadData& data = getThreadData();
+  if (data.starts.empty()) {
+    return;
+  }
+  const clock_type::time_point begin = data.starts.back();
+  data.starts.pop_back();
+
+  const double seconds = std::chrono::duration<double>(stop - begin).count();
+
+  const std::size_t index = data.lookup(p);
+  KernelStats& s = data.stats[index];
+  if (s.calls == 0 || seconds < s.min_seconds) {
+    s.min_seconds = seconds;
+  }
+  if (s.calls == 0 || seconds > s.max_seconds) {
+    s.max_seconds = seconds;
+  }
+  ++s.calls;
+  s.total_seconds += seconds;
+  if (p.num_iterations >= 0) {
+    s.iterations += p.num_iterations;
+  }
+
+  if (num_events.fetch_add(1, std::memory_order_relaxed) < max_events) {
+    const double start_us =
+        std::chrono::duration<double, std::micro>(begin - start).count();
+    data.events.push_back(
+        ThreadData::Event{index, start_us, seconds * 1.0e6, p.num_iterations});
+  } else {
+    ++data.dropped;
+  }
+}
+
+void TracePlugin::finalize()
+{
+  const char* summary_path = std::getenv("RAJA_TRACE_SUMMARY");
+  if (summary_path && *summary_path) {
+    std::ofstream summary(summary_path);
+    if (summary) {
+      writeSummary(summary);
+    } else {
+      std::cerr << "[TracePlugin]: could not open " << summary_path << "\n";
+    }
+  } else {
+    writeSummary(std::cout);
+  }
+
+  const char* trace_env = std::getenv("RAJA_TRACE_FILE");
+  const std::string trace_path = trace_env ? trace_env : "raja-trace.json";
+  if (!trace_path.empty()) {
+    std::ofstream trace(trace_path);
+    if (trace) {
+      writeTrace(trace);
+    } else {
+      std::cerr << "[TracePlugin]: could not open " << trace_path << "\n";
+    }
+  }
+}
+
+std::vector<TracePlugin::KernelStats> TracePlugin::getStats() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::vector<KernelStats> merged;
+  std::map<std::pair<std::string, std::string>, std::size_t> index;
+
+  for (const auto& data : threads) {
+    for (const KernelStats& s : data->stats) {
+      if (s.calls == 0) {
+        continue;
+      }
+      auto it = index.find(std::make_pair(s.name, s.policy));
+      if (it == index.end()) {
+        index.emplace(std::make_pair(s.name, s.policy), merged.size());
+        merged.push_back(s);
+        continue;
+      }
+      KernelStats& m = merged[it->second];
+      m.min_seconds = std::min(m.min_seconds, s.min_seconds);
+      m.max_seconds = std::max(m.max_seconds, s.max_seconds);
+      m.calls += s.calls;
+      m.total_seconds += s.total_seconds;
+      m.iterations += s.iterations;
+    }
+  }
+
+  std::stable_sort(merged.begin(),
+                   merged.end(),
+                   [](const KernelStats& a, const KernelStats& b) {
+                     return a.total_seconds > b.total_seconds;
+                   });
+  return merged;
+}
+
+std::size_t TracePlugin::getNumDroppedEvents() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::size_t dropped = 0;
+  for (const auto& data : threads) {
+    dropped += data->dropped;
+  }
+  return dropped;
+}
+
+void TracePlugin::writeSummary(std::ostream& os) const
+{
+  const std::vector<KernelStats> stats = getStats();
+
+  std::size_t launches = 0;
+  for (const KernelStats& s : stats) {
+    launches += s.calls;
+  }
+
+  char line[256];
+  os << "RAJA trace summary: " << stats.size() << " kernels, " << launches
+     << " launches\n";
+  std::snprintf(line,
+                sizeof(line),
+                "%10s %12s %12s %12s %12s %14s  %s\n",
+                "calls",
+                "total (ms)",
+                "avg (us)",
+                "min (us)",
+                "max (us)",
+                "iterations",
+                "kernel");
+  os << line;
+
+  for (const KernelStats& s : stats) {
+    std::snprintf(line,
+                  sizeof(line),
+                  "%10llu %12.3f %12.3f %12.3f %12.3f %14lld  ",
+                  static_cast<unsigned long long>(s.calls),
+                  s.total_seconds * 1.0e3,
+                  s.total_seconds * 1.0e6 / static_cast<double>(s.calls),
+                  s.min_seconds * 1.0e6,
+                  s.max_seconds * 1.0e6,
+                  s.iterations);
+    os << line << s.name << " [" << platformName(s.platform) << "]\n";
+  }
+
+  const std::size_t dropped = getNumDroppedEvents();
+  if (dropped > 0) {
+    os << dropped << " launches were left out of the trace, "
+       << "see RAJA_TRACE_MAX_EVENTS\n";
+  }
+}
+
+void TracePlugin::writeTrace(std::ostream& os) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  char number[64];
+  for (const auto& data : threads) {
+    for (const ThreadData::Event& e : data->events) {
+      const KernelStats& s = data->stats[e.stats];
+      os << (first ? "\n" : ",\n") << "{\"name\":";
+      writeJsonString(os, s.name);
+      os << ",\"cat\":\"" << platformName(s.platform) << "\",\"ph\":\"X\"";
+      std::snprintf(number, sizeof(number), "%.3f", e.start_us);
+      os << ",\"ts\":" << number;
+      std::snprintf(number, sizeof(number), "%.3f", e.duration_us);
+      os << ",\"dur\":" << number;
+      os << ",\"pid\":0,\"tid\":" << data->tid;
+      os << ",\"args\":{\"iterations\":" << e.iterations << ",\"policy\":";
+      writeJsonString(os, s.policy);
+      os << "}}";
+      first = false;
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}  // end namespace util
+}  // end namespace RAJA
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing basic functional tests for replicated atomic views
+/// with forall.
+///
+
+#ifndef __TEST_FORALL_REPLICATED_ATOMIC_VIEW_HPP__
+#define __TEST_FORALL_REPLICATED_ATOMIC_VIEW_HPP__
+
+template <typename ExecPolicy,
+          typename AtomicPolicy,
+          typename WORKINGRES,
+          typename IdxType,
+          typename T>
+void ForallReplicatedAtomicViewTestImpl( IdxType N, IdxType num_bins,
+                                         int num_replicas )
+{
+  RAJA::TypedRangeSegment<IdxType> seg(0, N);
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  IdxType * bin_of = host_res.allocate<IdxType>(N);
+  T * hist = host_res.allocate<T>(num_bins);
+  T * check_array = host_res.allocate<T>(num_bins);
+
+  for (IdxType b = 0; b < num_bins; ++b) {
+    hist[b] = (T)0;
+    check_array[b] = (T)0;
+  }
+  for (IdxType i = 0; i < N; ++i) {
+    bin_of[i] = (i * 7) % num_bins;
+    check_array[bin_of[i]] += (T)2;
+  }
+
+  RAJA::View<T, RAJA::Layout<1>> hist_view(hist, num_bins);
+  auto hist_atomic_view =
+    RAJA::make_replicated_atomic_view<AtomicPolicy>(hist_view, num_replicas);
+
+  ASSERT_GE(hist_atomic_view.get_num_replicas(), 1);
+  if (num_replicas > 0) {
+    ASSERT_EQ(hist_atomic_view.get_num_replicas(), num_replicas);
+  }
+
+  RAJA::forall<ExecPolicy>(seg, [=](IdxType i) {
+    hist_atomic_view(bin_of[i]) += (T)3;
+  });
+
+  RAJA::forall<ExecPolicy>(seg, [=](IdxType i) {
+    hist_atomic_view(bin_of[i])--;
+  });
+
+  // the updates only reach the view when the private copies are merged
+  hist_atomic_view.template merge<ExecPolicy>();
+
+  for (IdxType b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(check_array[b], hist[b]);
+  }
+
+  // merging resets the private copies, so a second pass adds to the view
+  RAJA::forall<ExecPolicy>(seg, [=](IdxType i) {
+    hist_atomic_view(bin_of[i])++;
+    hist_atomic_view(bin_of[i]) += (T)1;
+  });
+
+  hist_atomic_view.template merge<ExecPolicy>();
+
+  for (IdxType b = 0; b < num_bins; ++b) {
+    ASSERT_EQ((T)2 * check_array[b], hist[b]);
+  }
+
+  host_res.deallocate( bin_of );
+  host_res.deallocate( hist );
+  host_res.deallocate( check_array );
+}
+
+TYPED_TEST_SUITE_P(ForallReplicatedAtomicViewTest);
+template <typename T>
+class ForallReplicatedAtomicViewTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReplicatedAtomicViewTest, ReplicatedAtomicViewForall)
+{
+  using AExec   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using APol    = typename camp::at<TypeParam, camp::num<1>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<2>>::type;
+  using IdxType = typename camp::at<TypeParam, camp::num<3>>::type;
+  using DType   = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  // automatic replication, one shared copy, and copies shared by threads
+  ForallReplicatedAtomicViewTestImpl<AExec, APol, ResType, IdxType, DType>(
+      100000, 5, 0 );
+  ForallReplicatedAtomicViewTestImpl<AExec, APol, ResType, IdxType, DType>(
+      100000, 5, 1 );
+  ForallReplicatedAtomicViewTestImpl<AExec, APol, ResType, IdxType, DType>(
+      100000, 37, 3 );
+}
+
+TYPED_TEST_P(ForallReplicatedAtomicViewTest, ReplicationFactor)
+{
+  using DType   = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  // every thread gets a copy while all copies fit in the budget
+  ASSERT_EQ(RAJA::get_replicated_atomic_view_replication<DType>(16, 8), 8);
+  ASSERT_EQ(RAJA::get_replicated_atomic_view_replication<DType>(16, 1), 1);
+
+  // then as many copies as fit, down to one
+  const size_t copy_bytes = 1024 * sizeof(DType);
+  ASSERT_EQ(RAJA::get_replicated_atomic_view_replication<DType>(
+                1024, 8, 3 * copy_bytes), 3);
+  ASSERT_EQ(RAJA::get_replicated_atomic_view_replication<DType>(
+                1024, 8, copy_bytes), 1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReplicatedAtomicViewTest,
+                            ReplicatedAtomicViewForall,
+                            ReplicationFactor);
+
+#endif  //__TEST_FORALL_REPLICATED_ATOMIC_VIEW_HPP__
@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PARAMS_REDUCEMINMAX_HPP__
+#define __TEST_FORALL_PARAMS_REDUCEMINMAX_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE, typename EXEC_POLICY>
+void ForallParamsReduceMinMaxTestImpl(const SEG_TYPE& seg,
+                                      const std::vector<IDX_TYPE>& seg_idx,
+                                      camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  DATA_TYPE ref_min = modval;
+  DATA_TYPE ref_max = -1;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    ref_min = RAJA_MIN(ref_min, test_array[ seg_idx[i] ]);
+    ref_max = RAJA_MAX(ref_max, test_array[ seg_idx[i] ]);
+  }
+
+  DATA_TYPE min = modval;
+  DATA_TYPE max = -1;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::Reduce<RAJA::operators::minimum>(&min),
+    RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+    [=](IDX_TYPE idx, DATA_TYPE& mn, DATA_TYPE& mx) {
+      mn = RAJA_MIN(mn, working_array[idx]);
+      mx = RAJA_MAX(mx, working_array[idx]);
+  });
+
+  ASSERT_EQ(min, ref_min);
+  ASSERT_EQ(max, ref_max);
+
+  // targets take part in the reduction
+  DATA_TYPE min2 = -5;
+  DATA_TYPE max2 = modval + 5;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::Reduce<RAJA::operators::minimum>(&min2),
+    RAJA::expt::Reduce<RAJA::operators::maximum>(&max2),
+    [=](IDX_TYPE idx, DATA_TYPE& mn, DATA_TYPE& mx) {
+      mn = RAJA_MIN(mn, working_array[idx]);
+      mx = RAJA_MAX(mx, working_array[idx]);
+  });
+
+  ASSERT_EQ(min2, static_cast<DATA_TYPE>(-5));
+  ASSERT_EQ(max2, static_cast<DATA_TYPE>(modval + 5));
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+TYPED_TEST_SUITE_P(ForallParamsReduceMinMaxTest);
+template <typename T>
+class ForallParamsReduceMinMaxTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallParamsReduceMinMaxTest, ReduceMinMaxParamsForall)
+{
+  using IDX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallParamsReduceMinMaxTestImpl<IDX_TYPE, DATA_TYPE,
+                                        RAJA::TypedRangeSegment<IDX_TYPE>,
+                                        EXEC_POLICY>(r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallParamsReduceMinMaxTestImpl<IDX_TYPE, DATA_TYPE,
+                                        RAJA::TypedRangeSegment<IDX_TYPE>,
+                                        EXEC_POLICY>(r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallParamsReduceMinMaxTestImpl<IDX_TYPE, DATA_TYPE,
+                                        RAJA::TypedRangeSegment<IDX_TYPE>,
+                                        EXEC_POLICY>(r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallParamsReduceMinMaxTestImpl<IDX_TYPE, DATA_TYPE,
+                                        RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                        EXEC_POLICY>(r4, seg_idx, working_res);
+
+// List segment tests
+  seg_idx.clear();
+  IDX_TYPE last = 10567;
+  srand( time(NULL) );
+  for (IDX_TYPE i = 0; i < last; ++i) {
+    IDX_TYPE randval = IDX_TYPE( rand() % RAJA::stripIndexType(last) );
+    if ( i < randval ) {
+      seg_idx.push_back(i);
+    }
+  }
+  RAJA::TypedListSegment<IDX_TYPE> l1( &seg_idx[0], seg_idx.size(),
+                                       working_res );
+  ForallParamsReduceMinMaxTestImpl<IDX_TYPE, DATA_TYPE,
+                                        RAJA::TypedListSegment<IDX_TYPE>,
+                                        EXEC_POLICY>(l1, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamsReduceMinMaxTest,
+                            ReduceMinMaxParamsForall);
+
+#endif  // __TEST_FORALL_PARAMS_REDUCEMINMAX_HPP__
@@ -0,0 +1,148 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_PARAMS_REDUCESUM_HPP__
+#define __TEST_FORALL_PARAMS_REDUCESUM_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE, typename EXEC_POLICY>
+void ForallParamsReduceSumTestImpl(const SEG_TYPE& seg,
+                                   const std::vector<IDX_TYPE>& seg_idx,
+                                   camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  DATA_TYPE ref_sum = 0;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    ref_sum += test_array[ seg_idx[i] ];
+  }
+
+  DATA_TYPE sum = 0;
+  DATA_TYPE sum2 = 2;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum2),
+    [=](IDX_TYPE idx, DATA_TYPE& s, DATA_TYPE& s2) {
+      s  += working_array[idx];
+      s2 += working_array[idx];
+  });
+
+  ASSERT_EQ(sum, ref_sum);
+  ASSERT_EQ(sum2, ref_sum + 2);
+
+  // values accumulate into the targets across loops
+  sum = 0;
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(seg,
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](IDX_TYPE idx, DATA_TYPE& s) {
+        s += working_array[idx];
+    });
+  }
+
+  ASSERT_EQ(sum, nloops * ref_sum);
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+TYPED_TEST_SUITE_P(ForallParamsReduceSumTest);
+template <typename T>
+class ForallParamsReduceSumTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallParamsReduceSumTest, ReduceSumParamsForall)
+{
+  using IDX_TYPE    = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE   = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<3>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallParamsReduceSumTestImpl<IDX_TYPE, DATA_TYPE,
+                                     RAJA::TypedRangeSegment<IDX_TYPE>,
+                                     EXEC_POLICY>(r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallParamsReduceSumTestImpl<IDX_TYPE, DATA_TYPE,
+                                     RAJA::TypedRangeSegment<IDX_TYPE>,
+                                     EXEC_POLICY>(r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallParamsReduceSumTestImpl<IDX_TYPE, DATA_TYPE,
+                                     RAJA::TypedRangeSegment<IDX_TYPE>,
+                                     EXEC_POLICY>(r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallParamsReduceSumTestImpl<IDX_TYPE, DATA_TYPE,
+                                     RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                     EXEC_POLICY>(r4, seg_idx, working_res);
+
+// List segment tests
+  seg_idx.clear();
+  IDX_TYPE last = 10567;
+  srand( time(NULL) );
+  for (IDX_TYPE i = 0; i < last; ++i) {
+    IDX_TYPE randval = IDX_TYPE( rand() % RAJA::stripIndexType(last) );
+    if ( i < randval ) {
+      seg_idx.push_back(i);
+    }
+  }
+  RAJA::TypedListSegment<IDX_TYPE> l1( &seg_idx[0], seg_idx.size(),
+                                       working_res );
+  ForallParamsReduceSumTestImpl<IDX_TYPE, DATA_TYPE,
+                                     RAJA::TypedListSegment<IDX_TYPE>,
+                                     EXEC_POLICY>(l1, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamsReduceSumTest,
+                            ReduceSumParamsForall);
+
+#endif  // __TEST_FORALL_PARAMS_REDUCESUM_HPP__
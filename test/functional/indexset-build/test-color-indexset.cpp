@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the CSR lock-free color index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp" 
+
+#include "camp/resource.hpp"
+
+#include <vector>
+
+using ColorISetType = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                          RAJA::ListSegment>;
+
+//
+// Color the elements of an n x n quad mesh by the vertices they share and
+// check that each element is in exactly one color and that no two elements
+// of a color share a vertex.
+//
+void checkQuadMeshColoring(RAJA::Index_type n, RAJA::Index_type blockSize)
+{
+  const RAJA::Index_type numElem = n * n;
+  const RAJA::Index_type numVert = (n + 1) * (n + 1);
+
+  //
+  // Every seventh element lists one of its vertices twice, so elements
+  // have different numbers of vertices.
+  //
+  std::vector<RAJA::Index_type> offsets(1, 0);
+  std::vector<RAJA::Index_type> elem2vert;
+  for (RAJA::Index_type j = 0; j < n; ++j) {
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      const RAJA::Index_type v = i + j * (n + 1);
+      elem2vert.push_back(v);
+      elem2vert.push_back(v + 1);
+      elem2vert.push_back(v + n + 1);
+      elem2vert.push_back(v + n + 2);
+      if ((i + j * n) % 7 == 0) {
+        elem2vert.push_back(v);
+      }
+      offsets.push_back(static_cast<RAJA::Index_type>(elem2vert.size()));
+    }
+  }
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  ColorISetType iset;
+  RAJA::buildLockFreeColorIndexsetCSR(
+      iset, res, &offsets[0], &elem2vert[0], numElem, numVert, blockSize);
+
+  ASSERT_EQ(iset.getLength(), numElem);
+
+  std::vector<int> visits(numElem, 0);
+  for (int s = 0; s < static_cast<int>(iset.getNumSegments()); ++s) {
+    std::vector<RAJA::Index_type> vertColor(numVert, -1);
+    ColorISetType color = iset.createSlice(s, s + 1);
+    RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+        color, [&](RAJA::Index_type e) {
+          ++visits[e];
+          for (RAJA::Index_type k = offsets[e]; k < offsets[e + 1]; ++k) {
+            const RAJA::Index_type v = elem2vert[k];
+            ASSERT_TRUE(vertColor[v] == -1 || vertColor[v] == e);
+            vertColor[v] = e;
+          }
+        });
+  }
+
+  for (RAJA::Index_type e = 0; e < numElem; ++e) {
+    ASSERT_EQ(visits[e], 1);
+  }
+}
+
+TEST(IndexSetBuild, ColorCSR)
+{
+  checkQuadMeshColoring(1, 1);
+  checkQuadMeshColoring(10, 1);
+  checkQuadMeshColoring(301, 1);
+}
+
+TEST(IndexSetBuild, ColorCSRBlocked)
+{
+  checkQuadMeshColoring(10, 4);
+  checkQuadMeshColoring(301, 32);
+  checkQuadMeshColoring(301, 1000);
+}
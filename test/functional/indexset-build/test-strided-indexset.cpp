@@ -0,0 +1,201 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the parallel strided index set builder.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp" 
+
+#include "camp/resource.hpp"
+
+#include <numeric>
+#include <vector>
+
+using StridedISetType = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                            RAJA::RangeStrideSegment,
+                                            RAJA::ListSegment>;
+
+TEST(IndexSetBuild, Strided)
+{
+  const RAJA::Index_type range_min_length = 8;
+
+  using RSType = RAJA::RangeSegment;
+  using SSType = RAJA::RangeStrideSegment;
+  using LSType = RAJA::ListSegment;
+
+  //
+  // Create index vector containing indices:
+  // {0, 1, ..., 15,  17, 18,  20, 23, ..., 47,  51,  60, 58, ..., 40}
+  //
+  std::vector<RAJA::Index_type> indices(16);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  indices.push_back(17);
+  indices.push_back(18);
+
+  for (RAJA::Index_type i = 20; i < 48; i += 3) {
+    indices.push_back(i);
+  }
+
+  indices.push_back(51);
+
+  for (RAJA::Index_type i = 60; i >= 40; i -= 2) {
+    indices.push_back(i);
+  }
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  StridedISetType iset;
+
+  RAJA::Index_type* list_data =
+      RAJA::buildIndexSetStrided(iset,
+                                 res,
+                                 &indices[0],
+                                 static_cast<RAJA::Index_type>(indices.size()),
+                                 range_min_length);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+
+  ASSERT_EQ(iset.size(), 5);
+
+  const RSType& s0 = iset.getSegment<const RSType>(0);
+  ASSERT_EQ(s0.size(), 16);
+  ASSERT_EQ(*s0.begin(), 0);
+
+  const LSType& s1 = iset.getSegment<const LSType>(1);
+  ASSERT_EQ(s1.size(), 2);
+  ASSERT_EQ(*s1.begin(), 17);
+
+  const SSType& s2 = iset.getSegment<const SSType>(2);
+  ASSERT_EQ(s2.size(), 10);
+  ASSERT_EQ(*s2.begin(), 20);
+  ASSERT_EQ(*(s2.begin() + 1), 23);
+
+  const LSType& s3 = iset.getSegment<const LSType>(3);
+  ASSERT_EQ(s3.size(), 1);
+  ASSERT_EQ(*s3.begin(), 51);
+
+  const SSType& s4 = iset.getSegment<const SSType>(4);
+  ASSERT_EQ(s4.size(), 11);
+  ASSERT_EQ(*s4.begin(), 60);
+  ASSERT_EQ(*(s4.begin() + 10), 40);
+
+  // list segments share the returned data
+  ASSERT_EQ(s1.getIndexOwnership(), RAJA::Unowned);
+  ASSERT_EQ(&(*s1.begin()), list_data);
+  ASSERT_EQ(&(*s3.begin()), list_data + 2);
+
+  res.deallocate(list_data);
+}
+
+//
+// Sets the size of a segment and whether it is a range or range-stride
+// segment, see TypedIndexSet::segmentCall.
+//
+struct StridedSegmentSize {
+  void operator()(const RAJA::RangeSegment& seg,
+                  RAJA::Index_type& size,
+                  bool& strided) const
+  {
+    size = seg.size();
+    strided = true;
+  }
+
+  void operator()(const RAJA::RangeStrideSegment& seg,
+                  RAJA::Index_type& size,
+                  bool& strided) const
+  {
+    size = seg.size();
+    strided = true;
+  }
+
+  void operator()(const RAJA::ListSegment& seg,
+                  RAJA::Index_type& size,
+                  bool& strided) const
+  {
+    size = seg.size();
+    strided = false;
+  }
+};
+
+TEST(IndexSetBuild, StridedLarge)
+{
+  const RAJA::Index_type range_min_length = 32;
+
+  //
+  // Scan in a fixed number of parts rather than one part per OpenMP thread,
+  // so that the runs are merged across part boundaries in every build.
+  //
+  const int num_chunks = 7;
+
+  //
+  // Create a long index vector of runs with strides 1, 2 and -1 between
+  // short runs of scattered indices, so that runs cross the boundaries
+  // between the scanned parts.
+  //
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 0;
+  for (int block = 0; block < 2000; ++block) {
+    const RAJA::Index_type len = 50 + (block * 37) % 400;
+    const RAJA::Index_type stride = (block % 3 == 0) ? 1 :
+                                    (block % 3 == 1) ? 2 : -1;
+    RAJA::Index_type start = (stride < 0) ? next + len : next;
+    for (RAJA::Index_type i = 0; i < len; ++i) {
+      indices.push_back(start + i * stride);
+    }
+    next += 2 * len + 1;
+    for (int i = 0; i < block % 5; ++i) {
+      indices.push_back(next);
+      next += 3 + i;
+    }
+  }
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  StridedISetType iset;
+
+  const RAJA::Index_type length =
+      static_cast<RAJA::Index_type>(indices.size());
+
+  RAJA::Index_type* list_data =
+      RAJA::detail::buildIndexSetStrided(iset,
+                                         res,
+                                         &indices[0],
+                                         length,
+                                         range_min_length,
+                                         num_chunks);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+  ASSERT_LT(iset.getNumSegments(), 4000);
+
+  // some range or range-stride segment spans the boundary between two parts
+  int num_spanning = 0;
+  for (int i = 0; i < static_cast<int>(iset.getNumSegments()); ++i) {
+    const RAJA::Index_type start = iset.getStartingIcount(i);
+    RAJA::Index_type size = 0;
+    bool strided = false;
+    iset.segmentCall(i, StridedSegmentSize{}, size, strided);
+    for (int c = 1; c < num_chunks; ++c) {
+      const RAJA::Index_type boundary = (length * c) / num_chunks;
+      if (strided && start < boundary && boundary < start + size) {
+        ++num_spanning;
+      }
+    }
+  }
+  ASSERT_GT(num_spanning, 0);
+
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type idx) { visited.push_back(idx); });
+
+  ASSERT_EQ(visited, indices);
+
+  res.deallocate(list_data);
+}
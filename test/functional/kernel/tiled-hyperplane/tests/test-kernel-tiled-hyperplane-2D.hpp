@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_TILED_HYPERPLANE_2D_HPP__
+#define __TEST_KERNEL_TILED_HYPERPLANE_2D_HPP__
+
+#include <vector>
+
+template <typename INDEX_TYPE, typename EXEC_POLICY>
+void KernelTiledHyperplane2DTestImpl(const int n0, const int n1)
+{
+  // This test runs a sweep in which every point depends on its lower
+  // neighbors, so any iterate run out of order changes the result.
+
+  std::vector<long> test_array(n0 * n1, -1);
+  std::vector<long> check_array(n0 * n1, -1);
+
+  RAJA::View<long, RAJA::Layout<2>> TestView(test_array.data(), n0, n1);
+  RAJA::View<long, RAJA::Layout<2>> CheckView(check_array.data(), n0, n1);
+
+  auto sweep = [](RAJA::View<long, RAJA::Layout<2>> v, int i, int j) {
+    long value = 1;
+    if (i > 0) value += v(i - 1, j);
+    if (j > 0) value += 2 * v(i, j - 1);
+    v(i, j) = value % 1000003;
+  };
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      sweep(CheckView, i, j);
+    }
+  }
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> r0(0, n0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(0, n1);
+
+  RAJA::kernel<EXEC_POLICY>(RAJA::make_tuple(r0, r1),
+                            [=](INDEX_TYPE i, INDEX_TYPE j) {
+                              sweep(TestView, i, j);
+                            });
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      ASSERT_EQ(CheckView(i, j), TestView(i, j));
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelTiledHyperplane2DTest);
+template <typename T>
+class KernelTiledHyperplane2DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelTiledHyperplane2DTest, TiledHyperplane2DKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  KernelTiledHyperplane2DTestImpl<INDEX_TYPE, EXEC_POLICY>(1, 1);
+  KernelTiledHyperplane2DTestImpl<INDEX_TYPE, EXEC_POLICY>(0, 10);
+  KernelTiledHyperplane2DTestImpl<INDEX_TYPE, EXEC_POLICY>(37, 5);
+  KernelTiledHyperplane2DTestImpl<INDEX_TYPE, EXEC_POLICY>(151, 111);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelTiledHyperplane2DTest,
+                            TiledHyperplane2DKernel);
+
+#endif  // __TEST_KERNEL_TILED_HYPERPLANE_2D_HPP__
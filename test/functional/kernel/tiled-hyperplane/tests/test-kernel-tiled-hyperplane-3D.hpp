@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_KERNEL_TILED_HYPERPLANE_3D_HPP__
+#define __TEST_KERNEL_TILED_HYPERPLANE_3D_HPP__
+
+#include <vector>
+
+template <typename INDEX_TYPE, typename EXEC_POLICY>
+void KernelTiledHyperplane3DTestImpl(const int n0, const int n1, const int n2)
+{
+  // This test runs a sweep in which every point depends on its lower
+  // neighbors, so any iterate run out of order changes the result.
+
+  std::vector<long> test_array(n0 * n1 * n2, -1);
+  std::vector<long> check_array(n0 * n1 * n2, -1);
+
+  RAJA::View<long, RAJA::Layout<3>> TestView(test_array.data(), n0, n1, n2);
+  RAJA::View<long, RAJA::Layout<3>> CheckView(check_array.data(), n0, n1, n2);
+
+  auto sweep = [](RAJA::View<long, RAJA::Layout<3>> v, int i, int j, int k) {
+    long value = 1;
+    if (i > 0) value += v(i - 1, j, k);
+    if (j > 0) value += 2 * v(i, j - 1, k);
+    if (k > 0) value += 3 * v(i, j, k - 1);
+    v(i, j, k) = value % 1000003;
+  };
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      for (int k = 0; k < n2; ++k) {
+        sweep(CheckView, i, j, k);
+      }
+    }
+  }
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> r0(0, n0);
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(0, n1);
+  RAJA::TypedRangeSegment<INDEX_TYPE> r2(0, n2);
+
+  RAJA::kernel<EXEC_POLICY>(RAJA::make_tuple(r0, r1, r2),
+                            [=](INDEX_TYPE i, INDEX_TYPE j, INDEX_TYPE k) {
+                              sweep(TestView, i, j, k);
+                            });
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      for (int k = 0; k < n2; ++k) {
+        ASSERT_EQ(CheckView(i, j, k), TestView(i, j, k));
+      }
+    }
+  }
+}
+
+
+TYPED_TEST_SUITE_P(KernelTiledHyperplane3DTest);
+template <typename T>
+class KernelTiledHyperplane3DTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(KernelTiledHyperplane3DTest, TiledHyperplane3DKernel)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  KernelTiledHyperplane3DTestImpl<INDEX_TYPE, EXEC_POLICY>(1, 1, 1);
+  KernelTiledHyperplane3DTestImpl<INDEX_TYPE, EXEC_POLICY>(3, 0, 7);
+  KernelTiledHyperplane3DTestImpl<INDEX_TYPE, EXEC_POLICY>(10, 17, 9);
+  KernelTiledHyperplane3DTestImpl<INDEX_TYPE, EXEC_POLICY>(41, 33, 50);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(KernelTiledHyperplane3DTest,
+                            TiledHyperplane3DKernel);
+
+#endif  // __TEST_KERNEL_TILED_HYPERPLANE_3D_HPP__
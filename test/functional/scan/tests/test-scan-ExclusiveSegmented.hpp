@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_EXCLUSIVE_SEGMENTED_HPP__
+#define __TEST_SCAN_EXCLUSIVE_SEGMENTED_HPP__
+
+#include <numeric>
+
+template <typename OP, typename T>
+::testing::AssertionResult check_exclusive_segmented(const T* actual,
+                                                     const T* original,
+                                                     const int* flags,
+                                                     int N,
+                                                     T init = OP::identity())
+{
+  T val = init;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || flags[i]) {
+      val = init;
+    }
+    if (actual[i] != val) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << val << " (at index " << i << ")";
+    }
+    val = OP()(val, original[i]);
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanExclusiveSegmentedTestImpl(int N,
+                                    typename OP_TYPE::result_type offset =
+                                    OP_TYPE::identity())
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  int* work_flags;
+  int* work_keys;
+  int* host_flags;
+  int* host_keys;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  allocSegmentedScanTestData(N,
+                             working_res,
+                             &work_flags, &work_keys,
+                             &host_flags, &host_keys);
+
+  std::iota(host_in, host_in + N, 1);
+
+  // test interface without resource, segments given by flags
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(
+      RAJA::segment_flags(RAJA::make_span(work_flags, N)),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{},
+      offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_exclusive_segmented<OP_TYPE>(host_out, host_in,
+                                                 host_flags, N, offset));
+
+  // test interface with resource, segments given by keys
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(
+      res,
+      RAJA::segment_keys(RAJA::make_span(work_keys, N)),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{},
+      offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_exclusive_segmented<OP_TYPE>(host_out, host_in,
+                                                 host_flags, N, offset));
+
+  deallocSegmentedScanTestData(working_res,
+                               work_flags, work_keys,
+                               host_flags, host_keys);
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanExclusiveSegmentedTest);
+template <typename T>
+class ScanExclusiveSegmentedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanExclusiveSegmentedTest, ScanExclusiveSegmented)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(0);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(357);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(32000);
+  ScanExclusiveSegmentedTestImpl<EXEC_POLICY,
+                                 WORKING_RESOURCE,
+                                 OP_TYPE>(32000, 7);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanExclusiveSegmentedTest,
+                            ScanExclusiveSegmented);
+
+#endif // __TEST_SCAN_EXCLUSIVE_SEGMENTED_HPP__
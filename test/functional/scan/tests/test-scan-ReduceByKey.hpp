@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_REDUCE_BY_KEY_HPP__
+#define __TEST_SCAN_REDUCE_BY_KEY_HPP__
+
+#include <numeric>
+
+template <typename OP>
+::testing::AssertionResult check_reduce_by_key(
+  const typename OP::result_type* actual,
+  const int* actual_keys,
+  size_t num_segments,
+  const typename OP::result_type* original,
+  const int* flags,
+  const int* keys,
+  int N)
+{
+  size_t segment = 0;
+  typename OP::result_type init = OP::identity();
+  for (int i = 0; i < N; ++i) {
+    if (i != 0 && flags[i]) {
+      if (actual[segment] != init) {
+        return ::testing::AssertionFailure()
+               << actual[segment] << " != " << init
+               << " (at segment " << segment << ")";
+      }
+      ++segment;
+      init = OP::identity();
+    }
+    if ((i == 0 || flags[i]) && actual_keys && actual_keys[segment] != keys[i]) {
+      return ::testing::AssertionFailure()
+             << actual_keys[segment] << " != " << keys[i]
+             << " (at segment key " << segment << ")";
+    }
+    init = OP()(init, original[i]);
+  }
+  if (N > 0) {
+    if (actual[segment] != init) {
+      return ::testing::AssertionFailure()
+             << actual[segment] << " != " << init
+             << " (at segment " << segment << ")";
+    }
+    ++segment;
+  }
+  if (segment != num_segments) {
+    return ::testing::AssertionFailure()
+           << num_segments << " != " << segment << " segments";
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanReduceByKeyTestImpl(int N)
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  int* work_flags;
+  int* work_keys;
+  int* host_flags;
+  int* host_keys;
+
+  int* work_keys_out = working_res.allocate<int>(N);
+  int* host_keys_out = camp::resources::Resource{camp::resources::Host()}.allocate<int>(N);
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  allocSegmentedScanTestData(N,
+                             working_res,
+                             &work_flags, &work_keys,
+                             &host_flags, &host_keys);
+
+  std::iota(host_in, host_in + N, 1);
+
+  // test interface without resource, segments given by flags
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.wait();
+
+  size_t num_segments = RAJA::reduce_by_key<EXEC_POLICY>(
+      RAJA::segment_flags(RAJA::make_span(work_flags, N)),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{}).value();
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_reduce_by_key<OP_TYPE>(host_out, nullptr, num_segments,
+                                           host_in, host_flags, host_keys,
+                                           N));
+
+  // test interface with resource, segments given by keys
+  num_segments = RAJA::reduce_by_key<EXEC_POLICY>(
+      res,
+      RAJA::segment_keys(RAJA::make_span(work_keys, N),
+                         RAJA::make_span(work_keys_out, N)),
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      OP_TYPE{}).value();
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.memcpy(host_keys_out, work_keys_out, sizeof(int) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_reduce_by_key<OP_TYPE>(host_out, host_keys_out,
+                                           num_segments,
+                                           host_in, host_flags, host_keys,
+                                           N));
+
+  working_res.deallocate(work_keys_out);
+  camp::resources::Resource{camp::resources::Host()}.deallocate(host_keys_out);
+
+  deallocSegmentedScanTestData(working_res,
+                               work_flags, work_keys,
+                               host_flags, host_keys);
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanReduceByKeyTest);
+template <typename T>
+class ScanReduceByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanReduceByKeyTest, ScanReduceByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ScanReduceByKeyTestImpl<EXEC_POLICY,
+                          WORKING_RESOURCE,
+                          OP_TYPE>(0);
+  ScanReduceByKeyTestImpl<EXEC_POLICY,
+                          WORKING_RESOURCE,
+                          OP_TYPE>(357);
+  ScanReduceByKeyTestImpl<EXEC_POLICY,
+                          WORKING_RESOURCE,
+                          OP_TYPE>(32000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanReduceByKeyTest,
+                            ScanReduceByKey);
+
+#endif // __TEST_SCAN_REDUCE_BY_KEY_HPP__
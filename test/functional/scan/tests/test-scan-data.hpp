@@ -40,4 +40,46 @@ void deallocScanTestData(camp::resources::Resource work_res,
   host_res.deallocate(host_out);
 }
 
+//
+// Methods to allocate/deallocate segmented scan test data, flags and keys
+// describe the same segments of irregular lengths.
+//
+
+void allocSegmentedScanTestData(int N,
+                                camp::resources::Resource work_res,
+                                int** work_flags, int** work_keys,
+                                int** host_flags, int** host_keys)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  *work_flags = work_res.allocate<int>(N);
+  *work_keys  = work_res.allocate<int>(N);
+
+  *host_flags = host_res.allocate<int>(N);
+  *host_keys  = host_res.allocate<int>(N);
+
+  int key = 0;
+  for (int i = 0; i < N; ++i) {
+    (*host_flags)[i] = (i % 7 == 0 || i % 11 == 3) ? 1 : 0;
+    key += (*host_flags)[i];
+    (*host_keys)[i] = 3 * key;
+  }
+
+  work_res.memcpy(*work_flags, *host_flags, sizeof(int) * N);
+  work_res.memcpy(*work_keys, *host_keys, sizeof(int) * N);
+  work_res.wait();
+}
+
+void deallocSegmentedScanTestData(camp::resources::Resource work_res,
+                                  int* work_flags, int* work_keys,
+                                  int* host_flags, int* host_keys)
+{
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  work_res.deallocate(work_flags);
+  work_res.deallocate(work_keys);
+  host_res.deallocate(host_flags);
+  host_res.deallocate(host_keys);
+}
+
 #endif // __TEST_SCAN_DATA_HPP__
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_SHARED_MEM_HPP__
+#define __TEST_TEAMS_SHARED_MEM_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsSharedMemTestImpl()
+{
+
+  const int TILE = 16;
+  const int num_tiles = 20;
+  const int N = TILE * num_tiles;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*N,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  for (int i = 0; i < N*N; ++i) {
+    test_array[i] = i;
+  }
+
+  int* in_array = working_res.allocate<int>(N*N);
+  working_res.memcpy(in_array, test_array, sizeof(int) * N*N);
+
+  // a literal 0 is a null kernel name, not a shared memory size
+  RAJA::expt::Grid no_shared_mem(RAJA::expt::Teams(1), RAJA::expt::Threads(1), 0);
+  ASSERT_EQ(no_shared_mem.shared_mem_size, size_t(0));
+  ASSERT_EQ(no_shared_mem.kernel_name, nullptr);
+
+  //Select platform
+  RAJA::expt::ExecPlace select_cpu_or_gpu;
+  if (working_res.get_platform()  == camp::resources::Platform::host){
+    select_cpu_or_gpu = RAJA::expt::HOST;
+  }else{
+    select_cpu_or_gpu = RAJA::expt::DEVICE;
+  }
+
+  // Transpose through a tile in team shared memory. Each thread writes
+  // a column of the tile that other threads of the team loaded.
+  RAJA::expt::launch<LAUNCH_POLICY>(select_cpu_or_gpu,
+    RAJA::expt::Grid(RAJA::expt::Teams(num_tiles*num_tiles),
+                     RAJA::expt::Threads(TILE),
+                     RAJA::expt::SharedMem(TILE*TILE*sizeof(int))),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, num_tiles*num_tiles), [&](int t) {
+
+                const int bx = t % num_tiles;
+                const int by = t / num_tiles;
+
+                int* tile = ctx.getSharedMemory<int>(TILE*TILE);
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, TILE), [&](int ty) {
+                    for (int tx = 0; tx < TILE; ++tx) {
+                      tile[tx + TILE*ty] = in_array[(bx*TILE + tx) + N*(by*TILE + ty)];
+                    }
+                });
+
+                ctx.teamSync();
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, TILE), [&](int tx) {
+                    for (int ty = 0; ty < TILE; ++ty) {
+                      working_array[(by*TILE + ty) + N*(bx*TILE + tx)] = tile[tx + TILE*ty];
+                    }
+                });
+
+                // the tile is reloaded in the next team iteration
+                ctx.teamSync();
+                ctx.releaseSharedMemory();
+
+              });  // loop t
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*N);
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(test_array[c + N*r], check_array[r + N*c]);
+    }
+  }
+
+  working_res.deallocate(in_array);
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsSharedMemTest);
+template <typename T>
+class TeamsSharedMemTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsSharedMemTest, SharedMemTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsSharedMemTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsSharedMemTest,
+                            SharedMemTeams);
+
+#endif  // __TEST_TEAMS_SHARED_MEM_HPP__
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_BATCHED_Inverse_HPP__
+#define __TEST_TENSOR_BATCHED_Inverse_HPP__
+
+#include <vector>
+
+template <typename T, typename EXEC_POLICY, camp::idx_t N>
+void TensorBatchedInverseTestImpl(camp::idx_t batch_size)
+{
+  using view_t = RAJA::expt::BatchedMatrixView<T, N, N>;
+
+  std::vector<T> a_data(view_t::alloc_size(batch_size));
+  std::vector<T> inv_data(view_t::alloc_size(batch_size));
+
+  view_t a(a_data.data(), batch_size);
+  view_t inv(inv_data.data(), batch_size);
+
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < N;++ i){
+      for(camp::idx_t j = 0;j < N;++ j){
+        a(m, i, j) = batched_test_a<T>(m, i, j, N);
+      }
+    }
+  }
+
+  RAJA::expt::batched_matrix_inverse<EXEC_POLICY>(inv, a);
+
+  //
+  // Check that A*inv is the identity
+  //
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < N;++ i){
+      for(camp::idx_t j = 0;j < N;++ j){
+        T result(0);
+        for(camp::idx_t k = 0;k < N;++ k){
+          result += a(m, i, k) * inv(m, k, j);
+        }
+        ASSERT_NEAR(i == j ? T(1) : T(0), result,
+                    batched_test_tolerance<T>()*N*8);
+      }
+    }
+  }
+
+  //
+  // Invert in place
+  //
+  RAJA::expt::batched_matrix_inverse<EXEC_POLICY>(a, a);
+
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < N;++ i){
+      for(camp::idx_t j = 0;j < N;++ j){
+        ASSERT_NEAR(inv(m, i, j), a(m, i, j), batched_test_tolerance<T>());
+      }
+    }
+  }
+}
+
+
+TYPED_TEST_P(TestTensorBatched, Inverse)
+{
+  using T           = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  TensorBatchedInverseTestImpl<T, EXEC_POLICY, 2>(1);
+  TensorBatchedInverseTestImpl<T, EXEC_POLICY, 3>(37);
+  TensorBatchedInverseTestImpl<T, EXEC_POLICY, 5>(64);
+  TensorBatchedInverseTestImpl<T, EXEC_POLICY, 16>(19);
+}
+
+#endif  // __TEST_TENSOR_BATCHED_Inverse_HPP__
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_BATCHED_LUSolve_HPP__
+#define __TEST_TENSOR_BATCHED_LUSolve_HPP__
+
+#include <vector>
+
+template <typename T, typename EXEC_POLICY, camp::idx_t N, camp::idx_t NRHS>
+void TensorBatchedLUSolveTestImpl(camp::idx_t batch_size)
+{
+  using A_view_t = RAJA::expt::BatchedMatrixView<T, N, N>;
+  using X_view_t = RAJA::expt::BatchedMatrixView<T, N, NRHS>;
+
+  std::vector<T> lu_data(A_view_t::alloc_size(batch_size));
+  std::vector<T> x_data(X_view_t::alloc_size(batch_size));
+
+  A_view_t lu(lu_data.data(), batch_size);
+  X_view_t x(x_data.data(), batch_size);
+
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < N;++ i){
+      for(camp::idx_t j = 0;j < N;++ j){
+        lu(m, i, j) = batched_test_a<T>(m, i, j, N);
+      }
+      for(camp::idx_t r = 0;r < NRHS;++ r){
+        x(m, i, r) = batched_test_b<T>(m, i, r);
+      }
+    }
+  }
+
+  RAJA::expt::batched_lu_factor<EXEC_POLICY>(lu);
+  RAJA::expt::batched_lu_solve<EXEC_POLICY>(lu, x);
+
+  //
+  // Check that A*x reproduces the right hand sides
+  //
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t r = 0;r < NRHS;++ r){
+      for(camp::idx_t i = 0;i < N;++ i){
+        T result(0);
+        for(camp::idx_t k = 0;k < N;++ k){
+          result += batched_test_a<T>(m, i, k, N) * x(m, k, r);
+        }
+        ASSERT_NEAR(batched_test_b<T>(m, i, r), result,
+                    batched_test_tolerance<T>()*N*8);
+      }
+    }
+  }
+}
+
+
+TYPED_TEST_P(TestTensorBatched, LUSolve)
+{
+  using T           = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  TensorBatchedLUSolveTestImpl<T, EXEC_POLICY, 2, 1>(1);
+  TensorBatchedLUSolveTestImpl<T, EXEC_POLICY, 3, 1>(37);
+  TensorBatchedLUSolveTestImpl<T, EXEC_POLICY, 5, 3>(64);
+  TensorBatchedLUSolveTestImpl<T, EXEC_POLICY, 16, 2>(19);
+}
+
+#endif  // __TEST_TENSOR_BATCHED_LUSolve_HPP__
@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TENSOR_BATCHED_Multiply_HPP__
+#define __TEST_TENSOR_BATCHED_Multiply_HPP__
+
+#include <vector>
+
+template <typename T, typename EXEC_POLICY,
+          camp::idx_t M, camp::idx_t N, camp::idx_t K>
+void TensorBatchedMultiplyTestImpl(camp::idx_t batch_size)
+{
+  using A_view_t = RAJA::expt::BatchedMatrixView<T const, M, K>;
+  using B_view_t = RAJA::expt::BatchedMatrixView<T, K, N>;
+  using C_view_t = RAJA::expt::BatchedMatrixView<T, M, N>;
+
+  std::vector<T> a_data(A_view_t::alloc_size(batch_size));
+  std::vector<T> b_data(B_view_t::alloc_size(batch_size));
+  std::vector<T> c_data(C_view_t::alloc_size(batch_size));
+
+  RAJA::expt::BatchedMatrixView<T, M, K> a_init(a_data.data(), batch_size);
+  B_view_t b(b_data.data(), batch_size);
+  C_view_t c(c_data.data(), batch_size);
+
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < M;++ i){
+      for(camp::idx_t k = 0;k < K;++ k){
+        a_init(m, i, k) = batched_test_a<T>(m, i, k, K);
+      }
+    }
+    for(camp::idx_t k = 0;k < K;++ k){
+      for(camp::idx_t j = 0;j < N;++ j){
+        b(m, k, j) = batched_test_b<T>(m, k, j);
+      }
+    }
+  }
+
+  A_view_t a(a_init);
+
+  RAJA::expt::batched_matrix_multiply<EXEC_POLICY>(c, a, b);
+
+  for(camp::idx_t m = 0;m < batch_size;++ m){
+    for(camp::idx_t i = 0;i < M;++ i){
+      for(camp::idx_t j = 0;j < N;++ j){
+        T expected(0);
+        for(camp::idx_t k = 0;k < K;++ k){
+          expected += a(m, i, k) * b(m, k, j);
+        }
+        ASSERT_NEAR(expected, c(m, i, j), batched_test_tolerance<T>()*K*8);
+      }
+    }
+  }
+}
+
+
+TYPED_TEST_P(TestTensorBatched, Multiply)
+{
+  using T           = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  TensorBatchedMultiplyTestImpl<T, EXEC_POLICY, 2, 2, 2>(1);
+  TensorBatchedMultiplyTestImpl<T, EXEC_POLICY, 3, 3, 3>(37);
+  TensorBatchedMultiplyTestImpl<T, EXEC_POLICY, 4, 2, 5>(64);
+  TensorBatchedMultiplyTestImpl<T, EXEC_POLICY, 16, 16, 16>(19);
+}
+
+#endif  // __TEST_TENSOR_BATCHED_Multiply_HPP__
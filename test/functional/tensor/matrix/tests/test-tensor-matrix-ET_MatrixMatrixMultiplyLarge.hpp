@@ -0,0 +1,223 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TESNOR_MATRIX_ET_MatrixMatrixMultiplyLarge_HPP__
+#define __TEST_TESNOR_MATRIX_ET_MatrixMatrixMultiplyLarge_HPP__
+
+#include<RAJA/RAJA.hpp>
+
+//
+// Products with at least 64^3 multiply-adds take the packed multiply on
+// the CPU, so check uneven sizes, sub-matrices and accumulation against a
+// reference loop.
+//
+template <typename MATRIX_TYPE>
+void ET_MatrixMatrixMultiplyLargeImpl()
+{
+
+  using matrix_t = MATRIX_TYPE;
+  using policy_t = typename matrix_t::register_policy;
+  using element_t = typename matrix_t::element_type;
+
+
+  using A_matrix_t = matrix_t;
+  using B_matrix_t = typename matrix_t::transpose_type;
+  using C_matrix_t = typename matrix_t::product_type;
+
+  const camp::idx_t M = 70;
+  const camp::idx_t K = 90;
+  const camp::idx_t N = 75;
+
+  //
+  // Allocate Row-Major Data
+  //
+
+  // alloc data1 - The left matrix
+
+  std::vector<element_t> data1_vec(M*K);
+  RAJA::View<element_t, RAJA::Layout<2>> data1_h(data1_vec.data(), M, K);
+
+  element_t *data1_ptr = tensor_malloc<policy_t>(data1_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data1_d(data1_ptr, M, K);
+
+
+  // alloc data2 - The right matrix
+
+  std::vector<element_t> data2_vec(K*N);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_h(data2_vec.data(), K, N);
+
+  element_t *data2_ptr = tensor_malloc<policy_t>(data2_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data2_d(data2_ptr, K, N);
+
+
+  // alloc data3 - The result matrix
+
+  std::vector<element_t> data3_vec(M*N);
+  RAJA::View<element_t, RAJA::Layout<2>> data3_h(data3_vec.data(), M, N);
+
+  element_t *data3_ptr = tensor_malloc<policy_t>(data3_vec);
+  RAJA::View<element_t, RAJA::Layout<2>> data3_d(data3_ptr, M, N);
+
+
+
+  // Fill data1 and data2 with small values so every type sums exactly
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t k = 0;k < K; ++ k){
+      data1_h(i,k) = 1+(i+2*k)%7;
+    }
+  }
+  for(camp::idx_t k = 0;k < K; ++ k){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      data2_h(k,j) = 1+(3*k+j)%5;
+    }
+  }
+
+  tensor_copy_to_device<policy_t>(data1_ptr, data1_vec);
+  tensor_copy_to_device<policy_t>(data2_ptr, data2_vec);
+
+
+  //
+  // Do Operation: C = A*B
+  //
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    auto A_rows = RAJA::RowIndex<int, A_matrix_t>::all();
+    auto A_cols = RAJA::ColIndex<int, A_matrix_t>::all();
+
+    auto B_rows = RAJA::RowIndex<int, B_matrix_t>::all();
+    auto B_cols = RAJA::ColIndex<int, B_matrix_t>::all();
+
+    auto C_rows = RAJA::RowIndex<int, C_matrix_t>::all();
+    auto C_cols = RAJA::ColIndex<int, C_matrix_t>::all();
+
+    data3_d(C_rows, C_cols) = data1_d(A_rows, A_cols) * data2_d(B_rows, B_cols);
+
+  });
+
+  tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+  //
+  // Check results
+  //
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      element_t expected(0);
+      for(camp::idx_t k = 0;k < K; ++ k){
+        expected += data1_h(i,k)*data2_h(k,j);
+      }
+
+      ASSERT_SCALAR_EQ(expected, data3_h(i,j));
+
+    }
+  }
+
+
+  //
+  // Do Operation: C += A*B
+  //
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    auto A_rows = RAJA::RowIndex<int, A_matrix_t>::all();
+    auto A_cols = RAJA::ColIndex<int, A_matrix_t>::all();
+
+    auto B_rows = RAJA::RowIndex<int, B_matrix_t>::all();
+    auto B_cols = RAJA::ColIndex<int, B_matrix_t>::all();
+
+    auto C_rows = RAJA::RowIndex<int, C_matrix_t>::all();
+    auto C_cols = RAJA::ColIndex<int, C_matrix_t>::all();
+
+    data3_d(C_rows, C_cols) += data1_d(A_rows, A_cols) * data2_d(B_rows, B_cols);
+
+  });
+
+  tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+  //
+  // Check results
+  //
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      element_t expected(0);
+      for(camp::idx_t k = 0;k < K; ++ k){
+        expected += data1_h(i,k)*data2_h(k,j);
+      }
+
+      ASSERT_SCALAR_EQ(2*expected, data3_h(i,j));
+
+    }
+  }
+
+
+  //
+  // Do Operation: C(r0:M, c0:N) = A(r0:M, 0:k_size) * B(0:k_size, c0:N)
+  //
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      data3_h(i, j) = 0;
+    }
+  }
+
+  tensor_copy_to_device<policy_t>(data3_ptr, data3_vec);
+
+  const camp::idx_t r0 = 3;
+  const camp::idx_t c0 = 5;
+  const camp::idx_t k_size = K-1;
+
+  tensor_do<policy_t>([=] RAJA_HOST_DEVICE (){
+
+    auto A_rows = RAJA::RowIndex<int, A_matrix_t>::range(r0, M);
+    auto A_cols = RAJA::ColIndex<int, A_matrix_t>::range(0, k_size);
+
+    auto B_rows = RAJA::RowIndex<int, B_matrix_t>::range(0, k_size);
+    auto B_cols = RAJA::ColIndex<int, B_matrix_t>::range(c0, N);
+
+    auto C_rows = RAJA::RowIndex<int, C_matrix_t>::range(r0, M);
+    auto C_cols = RAJA::ColIndex<int, C_matrix_t>::range(c0, N);
+
+    data3_d(C_rows, C_cols) = data1_d(A_rows, A_cols) * data2_d(B_rows, B_cols);
+
+  });
+
+  tensor_copy_to_host<policy_t>(data3_vec, data3_ptr);
+
+  //
+  // Check results
+  //
+  for(camp::idx_t i = 0;i < M; ++ i){
+    for(camp::idx_t j = 0;j < N; ++ j){
+      element_t expected(0);
+      if(i >= r0 && j >= c0){
+        for(camp::idx_t k = 0;k < k_size; ++ k){
+          expected += data1_h(i,k)*data2_h(k,j);
+        }
+      }
+
+      ASSERT_SCALAR_EQ(expected, data3_h(i,j));
+
+    }
+  }
+
+
+
+  //
+  // Free data
+  //
+  tensor_free<policy_t>(data1_ptr);
+  tensor_free<policy_t>(data2_ptr);
+  tensor_free<policy_t>(data3_ptr);
+
+}
+
+
+
+TYPED_TEST_P(TestTensorMatrix, ET_MatrixMatrixMultiplyLarge)
+{
+  ET_MatrixMatrixMultiplyLargeImpl<TypeParam>();
+}
+
+
+#endif
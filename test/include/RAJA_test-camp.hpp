@@ -15,6 +15,8 @@
 #include "camp/resource.hpp"
 #include "camp/list.hpp"
 
+#include "RAJA/util/HostAsync.hpp"
+
 //
 // Memory resource types for back-end memory management
 //
@@ -22,6 +24,8 @@ using HostResourceList = camp::list<camp::resources::Host>;
 
 using SequentialResourceList = HostResourceList;
 
+using HostAsyncResourceList = camp::list<RAJA::resources::HostAsync>;
+
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPResourceList = HostResourceList;
 #endif
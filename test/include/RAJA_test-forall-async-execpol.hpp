@@ -22,6 +22,15 @@ using SequentialAsyncForallExecPols = SequentialForallExecPols;
 using SequentialAsyncForallReduceExecPols = SequentialForallReduceExecPols;
 using SequentialAsyncForallAtomicExecPols = SequentialForallAtomicExecPols;
 
+// Host execution policy types submitted to a RAJA::resources::HostAsync queue
+#if defined(RAJA_ENABLE_OPENMP)
+using HostAsyncAsyncForallExecPols = camp::list< RAJA::seq_exec,
+                                                RAJA::simd_exec,
+                                                RAJA::omp_parallel_for_exec >;
+#else
+using HostAsyncAsyncForallExecPols = SequentialForallExecPols;
+#endif
+
 #if defined(RAJA_ENABLE_OPENMP)
 
 using OpenMPAsyncForallExecPols = OpenMPForallExecPols;
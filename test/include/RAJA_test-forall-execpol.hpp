@@ -31,6 +31,8 @@ using SequentialForallReduceExecPols = camp::list< RAJA::seq_exec,
 using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec, 
                                                    RAJA::loop_exec >;
 
+using SequentialForallScanExecPols = SequentialForallExecPols;
+
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPForallExecPols = 
   camp::list< RAJA::omp_parallel_for_exec
@@ -38,10 +40,18 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_persistent_for_exec
+              , RAJA::omp_parallel_for_numa_exec
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
 
+              , RAJA::omp_persistent_for_static_exec<4>
+              , RAJA::omp_persistent_for_dynamic_exec< >
+              , RAJA::omp_persistent_for_guided_exec<4>
+              , RAJA::omp_persistent_exec<RAJA::omp_for_exec>
+
               , RAJA::omp_parallel_for_guided_exec< >
               , RAJA::omp_parallel_for_guided_exec<4>
 
@@ -94,6 +104,23 @@ using OpenMPForallAtomicExecPols =
 #endif
             >; 
 
+//
+// OpenMP execution policy types for scan tests, including the scan-only
+// policies with small blocks so the tests span many blocks.
+//
+using OpenMPForallScanExecPols =
+  camp::list< RAJA::omp_parallel_for_exec
+
+              , RAJA::omp_parallel_for_static_exec< >
+              , RAJA::omp_parallel_for_static_exec<4>
+
+              , RAJA::omp_parallel_reduce_then_scan_exec< >
+              , RAJA::omp_parallel_reduce_then_scan_exec<256>
+
+              , RAJA::omp_parallel_lookback_scan_exec< >
+              , RAJA::omp_parallel_lookback_scan_exec<256>
+            >;
+
 #endif  // RAJA_ENABLE_OPENMP
 
 #if defined(RAJA_ENABLE_TBB)
@@ -108,6 +135,8 @@ using TBBForallReduceExecPols = TBBForallExecPols;
 
 using TBBForallAtomicExecPols = TBBForallExecPols;
 
+using TBBForallScanExecPols = TBBForallExecPols;
+
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -119,6 +148,8 @@ using OpenMPTargetForallReduceExecPols = OpenMPTargetForallExecPols;
 
 using OpenMPTargetForallAtomicExecPols = OpenMPTargetForallExecPols;
 
+using OpenMPTargetForallScanExecPols = OpenMPTargetForallExecPols;
+
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -130,6 +161,8 @@ using CudaForallReduceExecPols = CudaForallExecPols;
 
 using CudaForallAtomicExecPols = CudaForallExecPols;
 
+using CudaForallScanExecPols = CudaForallExecPols;
+
 #endif
 
 #if defined(RAJA_ENABLE_HIP)
@@ -140,6 +173,8 @@ using HipForallReduceExecPols = HipForallExecPols;
 
 using HipForallAtomicExecPols = HipForallExecPols;
 
+using HipForallScanExecPols = HipForallExecPols;
+
 #endif
 
 #endif  // __RAJA_test_forall_execpol_HPP__
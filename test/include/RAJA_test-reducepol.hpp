@@ -24,7 +24,8 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_padded >;
 #endif
 #endif
 
@@ -90,6 +90,21 @@ using OpenMP_launch_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
 #endif
 
+//Host teams launch policies, run with the host resource only
+using OpenMP_team_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<1>>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_thread_loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<2>>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_thread_loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<4>>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_loop_exec>,
+         RAJA::expt::LoopPolicy<RAJA::omp_team_thread_loop_exec>>>;
+
 #endif  // RAJA_ENABLE_OPENMP
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -342,8 +342,19 @@ using OpenMPExecPolicyList =
     camp::list<
                 RAJA::omp_work
               >;
-using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderedPolicyList =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::ordered_omp_single_region
+              >;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::ordered_omp_single_region,
+                RAJA::unordered_omp_flattened_chunks
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
@@ -402,7 +413,8 @@ using HipStoragePolicyList = SequentialStoragePolicyList;
 //
 // Memory resource Allocator types
 //
-using HostAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Host>::template std_allocator<char>>;
+using HostAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Host>::template std_allocator<char>,
+                                     RAJA::basic_mempool::size_class_allocator<char>>;
 
 using SequentialAllocatorList = HostAllocatorList;
 
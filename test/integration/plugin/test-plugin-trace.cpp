@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Integration tests for the kernel metadata in the plugin context and the
+/// tracing plugin.
+///
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/TracePlugin.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Records the context of the last launch
+class ContextPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    kernel_name = p.kernel_name ? p.kernel_name : "";
+    policy_name = p.policy_name;
+    num_iterations = p.num_iterations;
+  }
+
+  static std::string kernel_name;
+  static std::string policy_name;
+  static RAJA::Index_type num_iterations;
+};
+
+std::string ContextPlugin::kernel_name;
+std::string ContextPlugin::policy_name;
+RAJA::Index_type ContextPlugin::num_iterations = 0;
+
+static RAJA::util::PluginRegistry::add<ContextPlugin> PC("context-plugin",
+                                                         "Context");
+static RAJA::util::PluginRegistry::add<RAJA::util::TracePlugin> PT(
+    "trace-plugin",
+    "Trace");
+
+RAJA::util::TracePlugin* getTracePlugin()
+{
+  for (auto plugin = RAJA::util::PluginRegistry::begin();
+       plugin != RAJA::util::PluginRegistry::end();
+       ++plugin) {
+    auto trace = dynamic_cast<RAJA::util::TracePlugin*>((*plugin).get());
+    if (trace) {
+      return trace;
+    }
+  }
+  return nullptr;
+}
+
+RAJA::util::TracePlugin::KernelStats getStats(const std::string& name)
+{
+  RAJA::util::TracePlugin* trace = getTracePlugin();
+  EXPECT_NE(trace, nullptr);
+  for (const auto& s : trace->getStats()) {
+    if (s.name == name) {
+      return s;
+    }
+  }
+  return RAJA::util::TracePlugin::KernelStats{
+      name, "", RAJA::Platform::undefined, 0, 0.0, 0.0, 0.0, 0};
+}
+
+TEST(PluginTraceTest, ForallContext)
+{
+  std::vector<int> a(100, 0);
+  int* a_ptr = a.data();
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                               RAJA::expt::KernelName("trace-context"),
+                               [=](int i) { a_ptr[i] += 1; });
+
+  ASSERT_EQ(ContextPlugin::kernel_name, "trace-context");
+  ASSERT_EQ(ContextPlugin::num_iterations, 100);
+  ASSERT_NE(ContextPlugin::policy_name.find("seq_exec"), std::string::npos);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeStrideSegment(0, 100, 3),
+                               [=](int i) { a_ptr[i] += 1; });
+
+  ASSERT_EQ(ContextPlugin::kernel_name, "");
+  ASSERT_EQ(ContextPlugin::num_iterations, 34);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 10));
+  iset.push_back(RAJA::RangeSegment(50, 70));
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [=](int i) { a_ptr[i] += 1; });
+
+  ASSERT_EQ(ContextPlugin::num_iterations, 30);
+
+  using KernelPol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  RAJA::kernel<KernelPol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 10), RAJA::RangeSegment(0, 10)),
+      [=](int i, int j) { a_ptr[i * 10 + j] += 1; });
+
+  ASSERT_EQ(ContextPlugin::kernel_name, "");
+  ASSERT_EQ(ContextPlugin::num_iterations, 100);
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(a[i], 2 + (i % 3 == 0) + (i < 10 || (i >= 50 && i < 70)));
+  }
+}
+
+TEST(PluginTraceTest, Stats)
+{
+  for (int n = 1; n <= 4; ++n) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n * 10),
+                                 RAJA::expt::KernelName("trace-stats"),
+                                 [=](int) {});
+  }
+
+  int sum = 0;
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, 10),
+      RAJA::expt::KernelName("trace-reduce"),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+
+  ASSERT_EQ(sum, 45);
+
+  RAJA::util::TracePlugin::KernelStats stats = getStats("trace-stats");
+  ASSERT_EQ(stats.calls, 4u);
+  ASSERT_EQ(stats.iterations, 100);
+  ASSERT_EQ(stats.platform, RAJA::Platform::host);
+  ASSERT_NE(stats.policy.find("seq_exec"), std::string::npos);
+  ASSERT_GE(stats.total_seconds, 0.0);
+  ASSERT_LE(stats.min_seconds, stats.max_seconds);
+  ASSERT_LE(stats.max_seconds, stats.total_seconds);
+
+  RAJA::util::TracePlugin::KernelStats reduce_stats = getStats("trace-reduce");
+  ASSERT_EQ(reduce_stats.calls, 1u);
+  ASSERT_EQ(reduce_stats.iterations, 10);
+}
+
+TEST(PluginTraceTest, Output)
+{
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 5),
+                               RAJA::expt::KernelName("trace \"output\""),
+                               [=](int) {});
+
+  RAJA::util::TracePlugin* trace = getTracePlugin();
+  ASSERT_NE(trace, nullptr);
+
+  std::ostringstream summary;
+  trace->writeSummary(summary);
+  ASSERT_NE(summary.str().find("RAJA trace summary"), std::string::npos);
+  ASSERT_NE(summary.str().find("trace \"output\""), std::string::npos);
+
+  std::ostringstream events;
+  trace->writeTrace(events);
+  const std::string json = events.str();
+  ASSERT_EQ(json.find("{\"traceEvents\":["), 0u);
+  ASSERT_NE(json.find("\"name\":\"trace \\\"output\\\"\""), std::string::npos);
+  ASSERT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+  ASSERT_NE(json.find("\"iterations\":5"), std::string::npos);
+
+  ASSERT_EQ(trace->getNumDroppedEvents(), 0u);
+}
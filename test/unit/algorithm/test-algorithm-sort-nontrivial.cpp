@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for host sorts of values that are not
+/// trivially movable; a moved from std::string compares differently, so
+/// comparing a value after it has been moved gives a wrong result.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename ExecPolicy>
+void testSortStrings(RAJA::Index_type N)
+{
+  std::mt19937 rng(N);
+  std::uniform_int_distribution<int> len_dist(20, 40);
+  std::uniform_int_distribution<int> char_dist('a', 'd');
+
+  std::vector<std::string> keys(N);
+  std::vector<RAJA::Index_type> vals(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    keys[i].resize(len_dist(rng));
+    for (char& c : keys[i]) {
+      c = static_cast<char>(char_dist(rng));
+    }
+    vals[i] = i;
+  }
+
+  std::vector<std::string> sorted = keys;
+  RAJA::sort<ExecPolicy>(sorted);
+
+  std::vector<std::string> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(sorted, expected);
+
+  // keep only the first character so equal keys test stability
+  std::vector<std::string> short_keys(N);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    short_keys[i] = std::string(24, keys[i][0]);
+  }
+
+  std::vector<std::string> stable_keys = short_keys;
+  std::vector<RAJA::Index_type> stable_vals = vals;
+  RAJA::stable_sort_pairs<ExecPolicy>(stable_keys, stable_vals);
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(stable_keys[i], short_keys[stable_vals[i]]);
+    if (i > 0) {
+      ASSERT_LE(stable_keys[i - 1], stable_keys[i]);
+      if (stable_keys[i - 1] == stable_keys[i]) {
+        ASSERT_LT(stable_vals[i - 1], stable_vals[i]);
+      }
+    }
+  }
+}
+
+TEST(SortNonTrivialUnitTest, SequentialStrings)
+{
+  testSortStrings<RAJA::seq_exec>(10000);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(SortNonTrivialUnitTest, OpenMPStrings)
+{
+  for (RAJA::Index_type N : {1000, 100000, 300007}) {
+    testSortStrings<RAJA::omp_parallel_for_exec>(N);
+  }
+}
+#endif
@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for copy_if, partition, stable_partition,
+/// and unique
+///
+
+#ifndef __TEST_UNIT_ALGORITHM_COMPACTION_HPP__
+#define __TEST_UNIT_ALGORITHM_COMPACTION_HPP__
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+using CompactionValueTypeList = camp::list< int,
+                                            unsigned long long,
+                                            double >;
+
+template < typename T >
+struct CompactionPred
+{
+  bool operator()(T const& val) const
+  {
+    return static_cast<long long>(val) % 3 == 1;
+  }
+};
+
+template < typename T >
+void compactionFillData(std::vector<T>& data)
+{
+  // runs of one to three equal values to exercise unique
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<T>((i / 3) % 17 + (i % 7 == 0 ? 1 : 0));
+  }
+}
+
+template < typename EXEC_POLICY, typename WORKING_RES, typename T >
+void CompactionTestImpl(size_t N)
+{
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+
+  std::vector<T> host_in(N);
+  compactionFillData(host_in);
+
+  T* work_in  = working_res.allocate<T>(N);
+  T* work_out = working_res.allocate<T>(N);
+  std::vector<T> host_out(N);
+
+  CompactionPred<T> pred{};
+
+  // copy_if, interface without resource
+  res.memcpy(work_in, host_in.data(), sizeof(T) * N);
+  res.wait();
+
+  size_t count = RAJA::copy_if<EXEC_POLICY>(
+      RAJA::make_span(static_cast<const T*>(work_in), N),
+      RAJA::make_span(work_out, N),
+      pred).value();
+
+  res.memcpy(host_out.data(), work_out, sizeof(T) * N);
+  res.wait();
+
+  std::vector<T> expected;
+  std::copy_if(host_in.begin(), host_in.end(),
+               std::back_inserter(expected), pred);
+  ASSERT_EQ(count, expected.size());
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]);
+  }
+
+  // stable_partition, interface with resource
+  res.memcpy(work_in, host_in.data(), sizeof(T) * N);
+
+  count = RAJA::stable_partition<EXEC_POLICY>(
+      res,
+      RAJA::make_span(work_in, N),
+      pred).value();
+
+  res.memcpy(host_out.data(), work_in, sizeof(T) * N);
+  res.wait();
+
+  expected = host_in;
+  auto expected_mid = std::stable_partition(expected.begin(),
+                                            expected.end(), pred);
+  ASSERT_EQ(count, static_cast<size_t>(expected_mid - expected.begin()));
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]);
+  }
+
+  // partition, compare partitioned sets
+  res.memcpy(work_in, host_in.data(), sizeof(T) * N);
+  res.wait();
+
+  count = RAJA::partition<EXEC_POLICY>(
+      RAJA::make_span(work_in, N),
+      pred).value();
+
+  res.memcpy(host_out.data(), work_in, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_EQ(count, static_cast<size_t>(expected_mid - expected.begin()));
+  ASSERT_TRUE(std::all_of(host_out.begin(), host_out.begin() + count, pred));
+  ASSERT_TRUE(std::none_of(host_out.begin() + count, host_out.end(), pred));
+  std::sort(host_out.begin(), host_out.end());
+  std::sort(expected.begin(), expected.end());
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]);
+  }
+
+  // unique, interface with resource
+  res.memcpy(work_in, host_in.data(), sizeof(T) * N);
+
+  count = RAJA::unique<EXEC_POLICY>(
+      res,
+      RAJA::make_span(work_in, N)).value();
+
+  res.memcpy(host_out.data(), work_in, sizeof(T) * N);
+  res.wait();
+
+  expected = host_in;
+  auto expected_end = std::unique(expected.begin(), expected.end());
+  ASSERT_EQ(count, static_cast<size_t>(expected_end - expected.begin()));
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(host_out[i], expected[i]);
+  }
+
+  working_res.deallocate(work_in);
+  working_res.deallocate(work_out);
+}
+
+
+TYPED_TEST_SUITE_P(CompactionUnitTest);
+template <typename T>
+class CompactionUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(CompactionUnitTest, Compaction)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using VALUE_TYPE       = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  CompactionTestImpl<EXEC_POLICY, WORKING_RESOURCE, VALUE_TYPE>(0);
+  CompactionTestImpl<EXEC_POLICY, WORKING_RESOURCE, VALUE_TYPE>(1);
+  CompactionTestImpl<EXEC_POLICY, WORKING_RESOURCE, VALUE_TYPE>(357);
+  CompactionTestImpl<EXEC_POLICY, WORKING_RESOURCE, VALUE_TYPE>(32000);
+  CompactionTestImpl<EXEC_POLICY, WORKING_RESOURCE, VALUE_TYPE>(100000);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CompactionUnitTest,
+                            Compaction);
+
+#endif //__TEST_UNIT_ALGORITHM_COMPACTION_HPP__
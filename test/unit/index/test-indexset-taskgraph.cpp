@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for IndexSet dependency graphs and
+/// their execution with the omp_taskgraph_segit policy.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+using RangeSegType = RAJA::TypedRangeSegment<int>;
+using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+TEST(IndexSetTaskGraphUnitTest, FinalizeSetsDependencyCounts)
+{
+  RIndexSetType iset;
+  for (int i = 0; i < 4; ++i) {
+    iset.push_back(RangeSegType(i * 10, (i + 1) * 10));
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  iset.initDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  // more forward-dependencies than the former fixed limit
+  for (int k = 0; k < 12; ++k) {
+    iset.getDepGraphNode(0)->addDepTask(1 + k % 3);
+  }
+  iset.getDepGraphNode(1)->addDepTask(3);
+  iset.finalizeDependencyGraph();
+
+  ASSERT_EQ(iset.getDepGraphNode(0)->numDepTasks(), 12);
+  ASSERT_EQ(iset.getDepGraphNode(0)->semaphoreReloadValue(), 0);
+  ASSERT_EQ(iset.getDepGraphNode(1)->semaphoreReloadValue(), 4);
+  ASSERT_EQ(iset.getDepGraphNode(2)->semaphoreReloadValue(), 4);
+  ASSERT_EQ(iset.getDepGraphNode(3)->semaphoreReloadValue(), 5);
+  ASSERT_EQ(iset.getDepGraphNode(3)->semaphoreValue().load(), 5);
+
+  ASSERT_FALSE(iset.getDepGraphNode(3)->satisfyOne());
+  ASSERT_EQ(iset.getDepGraphNode(3)->semaphoreValue().load(), 4);
+  iset.resetDependencyGraph();
+  ASSERT_EQ(iset.getDepGraphNode(3)->semaphoreValue().load(), 5);
+
+  RIndexSetType copy(iset);
+  ASSERT_TRUE(copy.dependencyGraphSet());
+  ASSERT_EQ(copy.getDepGraphNode(3)->semaphoreReloadValue(), 5);
+
+  // adding a segment invalidates the graph
+  iset.push_back(RangeSegType(40, 50));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(IndexSetTaskGraphUnitTest, RespectsDependenciesAndReuse)
+{
+  const int num_seg = 200;
+  const int seg_len = 16;
+
+  RIndexSetType iset;
+  for (int i = 0; i < num_seg; ++i) {
+    iset.push_back(RangeSegType(i * seg_len, (i + 1) * seg_len));
+  }
+
+  // random DAG with edges from lower to higher segment ids
+  std::vector<std::vector<int>> succ(num_seg);
+  iset.initDependencyGraph();
+  std::srand(4793);
+  for (int i = 0; i < num_seg; ++i) {
+    int num_dep = std::rand() % 12;
+    for (int k = 0; k < num_dep && i + 1 < num_seg; ++k) {
+      int j = i + 1 + std::rand() % (num_seg - i - 1);
+      iset.getDepGraphNode(i)->addDepTask(j);
+      succ[i].push_back(j);
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  std::vector<int> counts(num_seg * seg_len);
+  std::vector<int> stamps(num_seg);
+
+  for (int step = 0; step < 3; ++step) {
+    std::atomic<int> clock(0);
+    for (auto& c : counts) c = 0;
+
+    RAJA::forall<EXEC_POL>(iset, [&](int idx) {
+      ++counts[idx];
+      if (idx % seg_len == seg_len - 1) {
+        stamps[idx / seg_len] = clock.fetch_add(1);
+      }
+    });
+
+    for (int idx = 0; idx < num_seg * seg_len; ++idx) {
+      ASSERT_EQ(counts[idx], 1);
+    }
+    for (int i = 0; i < num_seg; ++i) {
+      for (int j : succ[i]) {
+        ASSERT_LT(stamps[i], stamps[j]);
+      }
+    }
+  }
+}
+
+TEST(IndexSetTaskGraphUnitTest, Chain)
+{
+  const int num_seg = 64;
+
+  RIndexSetType iset;
+  for (int i = 0; i < num_seg; ++i) {
+    iset.push_back(RangeSegType(i, i + 1));
+  }
+  iset.initDependencyGraph();
+  for (int i = 0; i < num_seg - 1; ++i) {
+    iset.getDepGraphNode(i)->addDepTask(i + 1);
+  }
+  iset.finalizeDependencyGraph();
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  for (int step = 0; step < 2; ++step) {
+    std::vector<int> order;
+    RAJA::forall<EXEC_POL>(iset, [&](int idx) { order.push_back(idx); });
+
+    ASSERT_EQ(order.size(), (size_t)num_seg);
+    for (int i = 0; i < num_seg; ++i) {
+      ASSERT_EQ(order[i], i);
+    }
+  }
+}
+
+TEST(IndexSetTaskGraphUnitTest, LockFreeBlockIndexSet)
+{
+  const int fastDim = 7;
+  const int midDim = 5;
+  const int slowDim = 97;
+
+  RIndexSetType iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  std::vector<int> counts(fastDim * midDim * slowDim, 0);
+  RAJA::forall<EXEC_POL>(iset, [&](int idx) { ++counts[idx]; });
+
+  for (int c : counts) {
+    ASSERT_EQ(c, 1);
+  }
+}
+
+TEST(IndexSetTaskGraphUnitTest, Errors)
+{
+  using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  RIndexSetType iset;
+  iset.push_back(RangeSegType(0, 4));
+  iset.push_back(RangeSegType(4, 8));
+
+  ASSERT_THROW(RAJA::forall<EXEC_POL>(iset, [](int) {}), std::runtime_error);
+
+  iset.initDependencyGraph();
+  iset.getDepGraphNode(0)->addDepTask(1);
+  iset.getDepGraphNode(1)->addDepTask(0);
+  iset.finalizeDependencyGraph();
+
+  ASSERT_THROW(RAJA::forall<EXEC_POL>(iset, [](int) {}), std::runtime_error);
+  ASSERT_EQ(iset.getDepGraphNode(0)->semaphoreValue().load(), 1);
+}
+
+#endif
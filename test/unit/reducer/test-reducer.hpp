@@ -28,7 +28,8 @@ using TBBReducerPolicyList = camp::list< RAJA::tbb_reduce >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducerPolicyList = camp::list< RAJA::omp_reduce,
-                                            RAJA::omp_reduce_ordered >;
+                                            RAJA::omp_reduce_ordered,
+                                            RAJA::omp_reduce_padded >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_RESOURCE_HOST_ASYNC_PATTERNS_HPP__
+#define __TEST_RESOURCE_HOST_ASYNC_PATTERNS_HPP__
+
+#include "RAJA_test-base.hpp"
+
+template <typename WORKING_RES, typename EXEC_POLICY>
+void ResourceHostAsyncPatternsTestImpl()
+{
+  constexpr int ARRAY_SIZE{10000};
+  using namespace RAJA;
+
+  WORKING_RES dev1;
+  WORKING_RES dev2;
+  resources::Host host;
+
+  int* keys = host.allocate<int>(ARRAY_SIZE);
+  int* vals = host.allocate<int>(ARRAY_SIZE);
+  int* sums = host.allocate<int>(ARRAY_SIZE);
+
+  using KERNEL_POLICY =
+      KernelPolicy< statement::For<0, EXEC_POLICY, statement::Lambda<0>> >;
+
+  kernel_resource<KERNEL_POLICY>(make_tuple(RangeSegment(0,ARRAY_SIZE)), dev1,
+    [=] (int i) {
+      keys[i] = ARRAY_SIZE - 1 - i;
+      vals[i] = i;
+    }
+  );
+
+  sort_pairs<seq_exec>(dev1, make_span(keys, ARRAY_SIZE),
+                             make_span(vals, ARRAY_SIZE));
+
+  forall<EXEC_POLICY>(dev2, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      sums[i] = 1;
+    }
+  );
+
+  resources::Event e =
+      inclusive_scan_inplace<seq_exec>(dev2, make_span(sums, ARRAY_SIZE));
+
+  dev1.wait_for(&e);
+
+  forall<EXEC_POLICY>(dev1, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      vals[i] += sums[i];
+    }
+  );
+
+  dev1.wait();
+
+  forall<policy::sequential::seq_exec>(host, RangeSegment(0,ARRAY_SIZE),
+    [=] (int i) {
+      ASSERT_EQ(keys[i], i);
+      ASSERT_EQ(vals[i], ARRAY_SIZE);
+    }
+  );
+
+  host.deallocate(keys);
+  host.deallocate(vals);
+  host.deallocate(sums);
+}
+
+TYPED_TEST_SUITE_P(ResourceHostAsyncPatternsTest);
+template <typename T>
+class ResourceHostAsyncPatternsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ResourceHostAsyncPatternsTest, ResourceHostAsyncPatterns)
+{
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  ResourceHostAsyncPatternsTestImpl<WORKING_RES, EXEC_POLICY>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceHostAsyncPatternsTest,
+                            ResourceHostAsyncPatterns);
+
+#endif  // __TEST_RESOURCE_HOST_ASYNC_PATTERNS_HPP__
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for first_touch
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/first_touch.hpp"
+
+#include <cstdint>
+#include <vector>
+
+template <typename ExecPolicy>
+void FirstTouchAllocateTestImpl(size_t n)
+{
+  double* data = RAJA::first_touch_allocate<ExecPolicy>(n, 3.5);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(data) %
+                RAJA::first_touch_page_align,
+            0u);
+  for (size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(data[i], 3.5);
+  }
+
+  RAJA::first_touch<ExecPolicy>(data, n / 2);
+  for (size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(data[i], i < n / 2 ? 0.0 : 3.5);
+  }
+
+  RAJA::free_aligned(data);
+}
+
+TEST(FirstTouchUnitTest, Sequential)
+{
+  FirstTouchAllocateTestImpl<RAJA::seq_exec>(1);
+  FirstTouchAllocateTestImpl<RAJA::seq_exec>(100000);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(FirstTouchUnitTest, OpenMPNuma)
+{
+  FirstTouchAllocateTestImpl<RAJA::omp_parallel_for_numa_exec>(1);
+  FirstTouchAllocateTestImpl<RAJA::omp_parallel_for_numa_exec>(100000);
+}
+
+TEST(FirstTouchUnitTest, OpenMPNumaMapping)
+{
+  const int n = 12345;
+  std::vector<int> touch(n, -1);
+  std::vector<int> use(n, -1);
+  int* touch_ptr = touch.data();
+  int* use_ptr = use.data();
+
+  RAJA::forall<RAJA::omp_parallel_for_numa_exec>(
+      RAJA::RangeSegment(0, n),
+      [=](int i) { touch_ptr[i] = omp_get_thread_num(); });
+
+  // a differently offset range of the same length and a kernel
+  RAJA::forall<RAJA::omp_parallel_for_numa_exec>(
+      RAJA::RangeSegment(n, 2 * n),
+      [=](int i) { use_ptr[i - n] = omp_get_thread_num(); });
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(touch[i], use[i]);
+    if (i > 0) {
+      ASSERT_LE(touch[i - 1], touch[i]);
+    }
+  }
+
+  using KERNEL_POL = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::omp_parallel_for_numa_exec,
+                           RAJA::statement::Lambda<0>>>;
+
+  RAJA::kernel<KERNEL_POL>(RAJA::make_tuple(RAJA::RangeSegment(0, n)),
+                           [=](int i) { use_ptr[i] = omp_get_thread_num(); });
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(touch[i], use[i]);
+  }
+}
+#endif
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for KernelTuner and TuningCache
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using RAJA::expt::KernelTuner;
+using RAJA::expt::TuningCache;
+using RAJA::expt::TuningConfig;
+using RAJA::expt::TuningSchedule;
+
+TEST(KernelTunerUnitTest, PicksFastest)
+{
+  TuningCache cache;
+  KernelTuner tuner("sleep",
+                    {{{1}}, {{2}}, {{3}, TuningSchedule::Dynamic, 4}},
+                    2,
+                    cache);
+
+  std::vector<int> calls(4, 0);
+  auto body = [&](const TuningConfig& config) {
+    ++calls[config.tile_sizes[0]];
+    if (config.tile_sizes[0] != 2) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  };
+
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_FALSE(tuner.is_tuned(100));
+    tuner.run(100, body);
+  }
+  ASSERT_TRUE(tuner.is_tuned(100));
+  ASSERT_EQ(calls[1], 2);
+  ASSERT_EQ(calls[2], 2);
+  ASSERT_EQ(calls[3], 2);
+
+  ASSERT_EQ(tuner.get_config(100).tile_sizes[0], 2);
+  tuner.run(100, body);
+  ASSERT_EQ(calls[2], 3);
+
+  // each problem size is tuned separately
+  ASSERT_FALSE(tuner.is_tuned(200));
+  ASSERT_EQ(tuner.get_config(200).tile_sizes[0], 1);
+
+  TuningConfig cached;
+  ASSERT_TRUE(cache.find("sleep", 100, cached));
+  ASSERT_EQ(cached.tile_sizes[0], 2);
+  ASSERT_FALSE(cache.find("sleep", 200, cached));
+}
+
+TEST(KernelTunerUnitTest, CacheFile)
+{
+  const char* path = "test-kernel-tuner-cache.txt";
+
+  TuningCache cache;
+  cache.insert("kernel a", 10, TuningConfig({32, 8}), 1.0e-3);
+  cache.insert("b", 20, TuningConfig({}, TuningSchedule::Guided, 16), 2.0);
+  ASSERT_TRUE(cache.save(path));
+
+  TuningCache loaded;
+  ASSERT_TRUE(loaded.load(path));
+  ASSERT_EQ(loaded.size(), 2u);
+
+  TuningConfig config;
+  ASSERT_TRUE(loaded.find("kernel a", 10, config));
+  ASSERT_EQ(config, TuningConfig({32, 8}));
+  ASSERT_TRUE(loaded.find("b", 20, config));
+  ASSERT_EQ(config, TuningConfig({}, TuningSchedule::Guided, 16));
+
+  // a tuner with a cached configuration does not tune
+  KernelTuner tuner("kernel a", {{{16, 16}}, {{64, 4}}}, 3, loaded);
+  ASSERT_TRUE(tuner.is_tuned(10));
+  int calls = 0;
+  tuner.run(10, [&](const TuningConfig& c) {
+    ++calls;
+    ASSERT_EQ(c.tile(0).size, 32);
+    ASSERT_EQ(c.tile(1).size, 8);
+  });
+  ASSERT_EQ(calls, 1);
+
+  std::remove(path);
+  ASSERT_FALSE(loaded.load(path));
+
+  {
+    std::ofstream bad(path);
+    bad << "# RAJA tuning cache 1\n";
+    bad << "kernel\tnot a number\t0\t0\t-\t1.0\n";
+  }
+  ASSERT_THROW(loaded.load(path), std::runtime_error);
+  std::remove(path);
+}
+
+TEST(KernelTunerUnitTest, Errors)
+{
+  TuningCache cache;
+  ASSERT_THROW(KernelTuner("empty", {}, 1, cache), std::runtime_error);
+  ASSERT_THROW(KernelTuner("samples", {{{1}}}, 0, cache), std::runtime_error);
+}
+
+TEST(KernelTunerUnitTest, KernelTileSizes)
+{
+  using POL = RAJA::KernelPolicy<
+      RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  TuningCache cache;
+  KernelTuner tuner("tiles", {{{3}}, {{7}}, {{64}}}, 1, cache);
+
+  std::vector<int> a(50, 0);
+  int* a_ptr = a.data();
+  for (int i = 0; i < 5; ++i) {
+    tuner.run(50, [&](const TuningConfig& config) {
+      RAJA::kernel_param<POL>(RAJA::make_tuple(RAJA::RangeSegment(0, 50)),
+                              RAJA::make_tuple(config.tile(0)),
+                              [=](int j, RAJA::TileSize) { a_ptr[j] += 1; });
+    });
+  }
+
+  for (int j = 0; j < 50; ++j) {
+    ASSERT_EQ(a[j], 5);
+  }
+  ASSERT_TRUE(tuner.is_tuned(50));
+}
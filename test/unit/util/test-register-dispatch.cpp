@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for RegisterDispatch
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdlib>
+#include <string>
+
+using RAJA::expt::RegisterDispatch;
+using RAJA::expt::register_isa;
+
+static int scalar_variant(int x) { return x + 1; }
+static int avx_variant(int x) { return x + 10; }
+static int avx2_variant(int x) { return x + 100; }
+static int avx512_variant(int x) { return x + 1000; }
+
+namespace raja_register_scalar
+{
+int twice(int x) { return 2 * x; }
+}  // namespace raja_register_scalar
+
+RAJA_DEFINE_REGISTER_DISPATCH(twice, int(int))
+
+TEST(RegisterDispatchUnitTest, Selection)
+{
+  using dispatch_t = RegisterDispatch<int(int)>;
+
+  dispatch_t all({{register_isa::scalar, &scalar_variant},
+                  {register_isa::avx, &avx_variant},
+                  {register_isa::avx512, &avx512_variant}},
+                 register_isa::avx512);
+  ASSERT_EQ(all.get_selected_isa(), register_isa::avx512);
+  ASSERT_EQ(all(1), 1001);
+  ASSERT_EQ(all.get(register_isa::avx2), nullptr);
+  ASSERT_EQ(all.get(register_isa::avx)(1), 11);
+
+  // the widest variant the CPU supports, skipping ISAs that were not built
+  dispatch_t avx2({{register_isa::scalar, &scalar_variant},
+                   {register_isa::avx, &avx_variant},
+                   {register_isa::avx512, &avx512_variant}},
+                  register_isa::avx2);
+  ASSERT_EQ(avx2.get_selected_isa(), register_isa::avx);
+  ASSERT_EQ(avx2(1), 11);
+
+  dispatch_t scalar({{register_isa::scalar, &scalar_variant},
+                     {register_isa::avx, &avx_variant}},
+                    register_isa::scalar);
+  ASSERT_EQ(scalar.get_selected_isa(), register_isa::scalar);
+  ASSERT_EQ(scalar(1), 2);
+
+  ASSERT_THROW(dispatch_t({{register_isa::avx, &avx_variant}},
+                          register_isa::scalar),
+               std::runtime_error);
+}
+
+TEST(RegisterDispatchUnitTest, DefineDispatch)
+{
+  ASSERT_EQ(twice_dispatch().get_selected_isa(), register_isa::scalar);
+  ASSERT_EQ(twice_dispatch()(21), 42);
+}
+
+TEST(RegisterDispatchUnitTest, CPU)
+{
+  const register_isa isa = RAJA::expt::get_cpu_register_isa();
+  ASSERT_GE(static_cast<int>(isa), 0);
+  ASSERT_LT(static_cast<int>(isa), RAJA::expt::num_register_isas);
+  ASSERT_EQ(isa, RAJA::expt::get_cpu_register_isa());
+
+  // RAJA_REGISTER_ISA only lowers the detected ISA
+  const char* forced = std::getenv("RAJA_REGISTER_ISA");
+  if (forced != nullptr) {
+    for (int i = 0; i < RAJA::expt::num_register_isas; ++i) {
+      const register_isa forced_isa = static_cast<register_isa>(i);
+      if (std::string(forced) ==
+          RAJA::expt::get_register_isa_name(forced_isa)) {
+        ASSERT_LE(static_cast<int>(isa), i);
+      }
+    }
+  }
+
+  // with every variant built, the dispatch selects exactly that ISA
+  RegisterDispatch<int(int)> all({{register_isa::scalar, &scalar_variant},
+                                  {register_isa::avx, &avx_variant},
+                                  {register_isa::avx2, &avx2_variant},
+                                  {register_isa::avx512, &avx512_variant}});
+  ASSERT_EQ(all.get_selected_isa(), isa);
+  ASSERT_EQ(all.get_selected(), all.get(isa));
+
+  ASSERT_EQ(std::string(RAJA::expt::get_register_isa_name(register_isa::avx2)),
+            "avx2");
+}
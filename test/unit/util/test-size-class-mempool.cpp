@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for SizeClassMemPool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using pool_type =
+    RAJA::basic_mempool::SizeClassMemPool<RAJA::basic_mempool::generic_allocator>;
+
+TEST(SizeClassMemPoolUnitTest, AlignedDistinctBlocks)
+{
+  pool_type& pool = pool_type::getInstance();
+
+  std::vector<char*> ptrs;
+  std::vector<size_t> sizes;
+  std::vector<size_t> alignments;
+  std::set<char*> distinct;
+
+  for (size_t size : {0, 1, 15, 16, 17, 100, 4096, 100000, (2 << 20) + 3}) {
+    for (size_t alignment : {1, 8, 64, 256, 8192}) {
+      char* ptr = pool.malloc<char>(size, alignment);
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+      for (size_t i = 0; i < size; ++i) {
+        ptr[i] = static_cast<char>(ptrs.size());
+      }
+      ASSERT_TRUE(distinct.insert(ptr).second);
+      ptrs.push_back(ptr);
+      sizes.push_back(size);
+      alignments.push_back(alignment);
+    }
+  }
+
+  for (size_t n = 0; n < ptrs.size(); ++n) {
+    for (size_t i = 0; i < sizes[n]; ++i) {
+      ASSERT_EQ(ptrs[n][i], static_cast<char>(n));
+    }
+    pool.free(ptrs[n], sizes[n], alignments[n]);
+  }
+}
+
+TEST(SizeClassMemPoolUnitTest, ReuseFreedBlock)
+{
+  pool_type& pool = pool_type::getInstance();
+
+  double* ptr = pool.malloc<double>(10);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr, 10);
+
+  // the thread cache hands back the most recently freed block
+  double* again = pool.malloc<double>(12);
+  ASSERT_EQ(again, ptr);
+  pool.free(again, 12);
+}
+
+TEST(SizeClassMemPoolUnitTest, CrossThreadFree)
+{
+  pool_type& pool = pool_type::getInstance();
+
+  const int num_blocks = 10000;
+  std::vector<int*> ptrs(num_blocks);
+
+  std::thread producer([&]() {
+    for (int i = 0; i < num_blocks; ++i) {
+      ptrs[i] = pool.malloc<int>(i % 64 + 1);
+      ptrs[i][0] = i;
+    }
+  });
+  producer.join();
+
+  for (int i = 0; i < num_blocks; ++i) {
+    ASSERT_EQ(ptrs[i][0], i);
+    pool.free(ptrs[i], i % 64 + 1);
+  }
+  pool.release_thread_cache();
+}
+
+TEST(SizeClassMemPoolUnitTest, StdAllocator)
+{
+  std::vector<int, RAJA::basic_mempool::size_class_allocator<int>> vec;
+  for (int i = 0; i < 100000; ++i) {
+    vec.push_back(i);
+  }
+  for (int i = 0; i < 100000; ++i) {
+    ASSERT_EQ(vec[i], i);
+  }
+
+  RAJA::basic_mempool::size_class_allocator<int> int_alloc;
+  RAJA::basic_mempool::size_class_allocator<char> char_alloc(int_alloc);
+  ASSERT_TRUE(int_alloc == char_alloc);
+}
@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-22, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+/*
+ * Tiled and Morton layout tests
+ */
+
+RAJA_INDEX_VALUE(TIX, "TIX");
+RAJA_INDEX_VALUE(TIY, "TIY");
+
+// Checks that the layout maps the index space one to one into [0, size())
+// and that toIndices inverts the mapping
+template <typename LAYOUT>
+void checkLayout2D(const LAYOUT& layout, int ni, int nj)
+{
+  std::vector<int> hits(layout.size(), 0);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      RAJA::Index_type lin = layout(i, j);
+      ASSERT_GE(lin, 0);
+      ASSERT_LT(lin, layout.size());
+      ++hits[lin];
+
+      int ii, jj;
+      layout.toIndices(lin, ii, jj);
+      ASSERT_EQ(ii, i);
+      ASSERT_EQ(jj, j);
+    }
+  }
+
+  for (int h : hits) {
+    ASSERT_LE(h, 1);
+  }
+}
+
+template <typename LAYOUT>
+void checkLayout3D(const LAYOUT& layout, int ni, int nj, int nk)
+{
+  std::vector<int> hits(layout.size(), 0);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      for (int k = 0; k < nk; ++k) {
+        RAJA::Index_type lin = layout(i, j, k);
+        ASSERT_GE(lin, 0);
+        ASSERT_LT(lin, layout.size());
+        ++hits[lin];
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+
+  for (int h : hits) {
+    ASSERT_LE(h, 1);
+  }
+}
+
+TEST(TiledLayoutUnitTest, 2D)
+{
+  const RAJA::TiledLayout<16, 16> layout(100, 100);
+
+  // 7 x 7 tiles of 256 elements
+  ASSERT_EQ(12544, layout.size());
+  ASSERT_EQ(100, layout.get_dim_size<0>());
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(16, layout(1, 0));
+  ASSERT_EQ(256, layout(0, 16));
+  ASSERT_EQ(7 * 256, layout(16, 0));
+  ASSERT_EQ(2323, layout(17, 35));
+
+  checkLayout2D(layout, 100, 100);
+
+  // copy and assignment
+  const RAJA::TiledLayout<16, 16> layout_b(layout);
+  RAJA::TiledLayout<16, 16> layout_c;
+  layout_c = layout_b;
+  ASSERT_EQ(2323, layout_c(17, 35));
+
+  checkLayout2D(RAJA::TiledLayout<4, 8>(13, 29), 13, 29);
+}
+
+TEST(TiledLayoutUnitTest, 3D)
+{
+  checkLayout3D(RAJA::TiledLayout<4, 4, 4>(9, 5, 17), 9, 5, 17);
+  checkLayout3D(RAJA::TiledLayout<3, 1, 5>(9, 5, 17), 9, 5, 17);
+  checkLayout3D(RAJA::TiledLayoutT<int, 8, 8, 8>(16, 16, 16), 16, 16, 16);
+}
+
+TEST(MortonLayoutUnitTest, 2D)
+{
+  const RAJA::MortonLayout<2> layout(4, 4);
+
+  ASSERT_EQ(16, layout.size());
+
+  // bits i1 j1 i0 j0
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  ASSERT_EQ(4, layout(0, 2));
+  ASSERT_EQ(13, layout(2, 3));
+
+  checkLayout2D(layout, 4, 4);
+  checkLayout2D(RAJA::MortonLayout<2>(100, 100), 100, 100);
+
+  // unequal numbers of bits
+  const RAJA::MortonLayout<2> layout_b(1024, 16);
+  ASSERT_EQ(1024 * 16, layout_b.size());
+  checkLayout2D(layout_b, 1024, 16);
+  checkLayout2D(RAJA::MortonLayout<2>(3, 37), 3, 37);
+}
+
+TEST(MortonLayoutUnitTest, 3D)
+{
+  const RAJA::MortonLayout<3> layout(8, 8, 8);
+
+  ASSERT_EQ(512, layout.size());
+
+  // bits i0 j0 k0 from high to low
+  ASSERT_EQ(1, layout(0, 0, 1));
+  ASSERT_EQ(2, layout(0, 1, 0));
+  ASSERT_EQ(4, layout(1, 0, 0));
+  ASSERT_EQ(7 * 73, layout(7, 7, 7));
+
+  checkLayout3D(layout, 8, 8, 8);
+  checkLayout3D(RAJA::MortonLayout<3>(30, 7, 65), 30, 7, 65);
+}
+
+TEST(MortonLayoutUnitTest, Projection)
+{
+  const RAJA::MortonLayout<3> layout(8, 0, 8);
+
+  ASSERT_EQ(64, layout.size());
+  ASSERT_EQ(layout(3, 0, 2), layout(3, 5, 2));
+
+  int i, j, k;
+  layout.toIndices(layout(3, 5, 2), i, j, k);
+  ASSERT_EQ(3, i);
+  ASSERT_EQ(0, j);
+  ASSERT_EQ(2, k);
+}
+
+TEST(MortonLayoutUnitTest, TooLarge)
+{
+  const RAJA::Index_type n = RAJA::Index_type(1) << 40;
+  ASSERT_THROW(RAJA::MortonLayout<2>(n, n), std::runtime_error);
+}
+
+TEST(SpaceFillingLayoutUnitTest, View)
+{
+  const int ni = 13;
+  const int nj = 21;
+
+  RAJA::TiledLayout<4, 8> tiled(ni, nj);
+  RAJA::MortonLayout<2> morton(ni, nj);
+
+  std::vector<int> tiled_data(tiled.size(), -1);
+  std::vector<int> morton_data(morton.size(), -1);
+
+  RAJA::View<int, RAJA::TiledLayout<4, 8>> tiled_view(tiled_data.data(),
+                                                      tiled);
+  RAJA::View<int, RAJA::MortonLayout<2>> morton_view(morton_data.data(),
+                                                     ni, nj);
+  RAJA::TypedView<int, RAJA::MortonLayout<2>, TIX, TIY> typed_view(
+      morton_data.data(), morton);
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      tiled_view(i, j) = i * nj + j;
+      morton_view(i, j) = i * nj + j;
+    }
+  }
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(i * nj + j, tiled_data[tiled(i, j)]);
+      ASSERT_EQ(i * nj + j, typed_view(TIX(i), TIY(j)));
+    }
+  }
+
+  // MultiView with the array-of-pointers index first
+  std::vector<int> tiled_data2(tiled.size(), -1);
+  int* ptrs[2] = {tiled_data.data(), tiled_data2.data()};
+  RAJA::MultiView<int, RAJA::TiledLayout<4, 8>> multi_view(ptrs, tiled);
+
+  multi_view(1, 3, 5) = 42;
+  ASSERT_EQ(3 * nj + 5, multi_view(0, 3, 5));
+  ASSERT_EQ(42, tiled_data2[tiled(3, 5)]);
+}